@@ -94,6 +94,12 @@ def if_has_openmp(a, b = []):
         "//conditions:default": b,
     })
 
+def if_has_work_stealing(a, b = []):
+    return select({
+        "@kroma_network_tachyon//:tachyon_has_work_stealing": a,
+        "//conditions:default": b,
+    })
+
 def if_polygon_zkevm_backend(a, b = []):
     return select({
         "@kroma_network_tachyon//:tachyon_polygon_zkevm_backend": a,
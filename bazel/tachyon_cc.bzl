@@ -6,6 +6,7 @@ load(
     "if_has_matplotlib",
     "if_has_openmp",
     "if_has_rtti",
+    "if_has_work_stealing",
     "if_linux_x86_64",
     "if_static",
 )
@@ -43,6 +44,9 @@ def tachyon_cxxopts(safe_code = True, force_exceptions = False, force_rtti = Fal
 def tachyon_openmp_defines():
     return if_has_openmp(["TACHYON_HAS_OPENMP"])
 
+def tachyon_work_stealing_defines():
+    return if_has_work_stealing(["TACHYON_HAS_WORK_STEALING"])
+
 def tachyon_cuda_defines():
     return if_cuda(["TACHYON_CUDA"])
 
@@ -50,7 +54,7 @@ def tachyon_matplotlib_defines():
     return if_has_matplotlib(["TACHYON_HAS_MATPLOTLIB"])
 
 def tachyon_defines(use_cuda = False):
-    defines = tachyon_defines_shared_lib_build() + tachyon_openmp_defines()
+    defines = tachyon_defines_shared_lib_build() + tachyon_openmp_defines() + tachyon_work_stealing_defines()
     if use_cuda:
         defines += tachyon_cuda_defines()
     return defines
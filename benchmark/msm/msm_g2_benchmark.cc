@@ -0,0 +1,80 @@
+#include <iostream>
+
+// clang-format off
+#include "benchmark/msm/msm_config.h"
+#include "benchmark/msm/msm_runner.h"
+#include "benchmark/msm/simple_msm_benchmark_reporter.h"
+// clang-format on
+#include "tachyon/base/time/time.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g2_point_traits.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/msm_g2.h"
+#include "tachyon/cc/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon {
+
+using namespace math;
+
+// Runs Pippenger with XYZZ buckets as a baseline for the buckets in affine
+// coordinates, which |tachyon_bn254_g2_affine_msm()| uses for large inputs.
+tachyon_bn254_g2_jacobian* RunPippenger(const tachyon_bn254_g2_affine* bases,
+                                        const tachyon_bn254_fr* scalars,
+                                        size_t size, uint64_t* duration_in_us) {
+  base::TimeTicks now = base::TimeTicks::Now();
+  absl::Span<const bn254::G2AffinePoint> bases_span(
+      reinterpret_cast<const bn254::G2AffinePoint*>(bases), size);
+  absl::Span<const bn254::Fr> scalars_span(
+      reinterpret_cast<const bn254::Fr*>(scalars), size);
+  PippengerAdapter<bn254::G2AffinePoint> pippenger;
+  bn254::G2PointXYZZ bucket;
+  CHECK(pippenger.Run(bases_span.begin(), bases_span.end(),
+                      scalars_span.begin(), scalars_span.end(), &bucket));
+  *duration_in_us = (base::TimeTicks::Now() - now).InMicroseconds();
+  tachyon_bn254_g2_jacobian* ret = new tachyon_bn254_g2_jacobian();
+  cc::math::ToCPoint3(ConvertPoint<bn254::G2JacobianPoint>(bucket), ret);
+  return ret;
+}
+
+int RealMain(int argc, char** argv) {
+  MSMConfig config;
+  MSMConfig::Options options;
+  if (!config.Parse(argc, argv, options)) {
+    return 1;
+  }
+
+  SimpleMSMBenchmarkReporter reporter("MSM G2 Benchmark", config.degrees());
+  reporter.AddVendor("pippenger");
+
+  std::vector<uint64_t> point_nums = config.GetPointNums();
+
+  tachyon_bn254_g2_init();
+  tachyon_bn254_g2_msm_ptr msm =
+      tachyon_bn254_g2_create_msm(config.degrees().back());
+
+  std::cout << "Generating random points..." << std::endl;
+  uint64_t max_point_num = point_nums.back();
+  VariableBaseMSMTestSet<bn254::G2AffinePoint> test_set;
+  CHECK(config.GenerateTestSet(max_point_num, &test_set));
+  std::cout << "Generation completed" << std::endl;
+
+  MSMRunner<bn254::G2AffinePoint> runner(&reporter);
+  runner.SetInputs(&test_set.bases, &test_set.scalars);
+  std::vector<bn254::G2JacobianPoint> results;
+  runner.Run(tachyon_bn254_g2_affine_msm, msm, point_nums, &results);
+  std::vector<bn254::G2JacobianPoint> results_pippenger;
+  runner.RunExternal(RunPippenger, point_nums, &results_pippenger);
+  if (config.check_results()) {
+    CHECK(results == results_pippenger) << "Result not matched";
+  }
+
+  reporter.Show();
+
+  tachyon_bn254_g2_destroy_msm(msm);
+
+  return 0;
+}
+
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
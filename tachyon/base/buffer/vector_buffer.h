@@ -38,6 +38,13 @@ class VectorBuffer : public Buffer {
 
   std::vector<T>&& TakeOwnedBuffer() && { return std::move(owned_buffer_); }
 
+  // Reserves room for |capacity| bytes without changing the length of the
+  // buffer, so that the writes up to |capacity| bytes don't reallocate it.
+  void Reserve(size_t capacity) {
+    owned_buffer_.reserve(capacity);
+    UpdateBuffer();
+  }
+
   [[nodiscard]] bool Grow(size_t size) override {
     owned_buffer_.resize(size);
     UpdateBuffer();
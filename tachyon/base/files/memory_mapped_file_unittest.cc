@@ -0,0 +1,63 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <string_view>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+TEST(MemoryMappedFileTest, MapWholeFile) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  FilePath file_path = temp_dir.GetPath().Append("file");
+  constexpr std::string_view kContents = "memory mapped file";
+  ASSERT_TRUE(WriteFile(file_path, kContents));
+
+  MemoryMappedFile map;
+  ASSERT_TRUE(map.Initialize(file_path));
+  ASSERT_TRUE(map.IsValid());
+  ASSERT_EQ(map.length(), kContents.size());
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(map.data()),
+                             map.length()),
+            kContents);
+
+  // It can't be initialized twice.
+  EXPECT_FALSE(map.Initialize(file_path));
+}
+
+TEST(MemoryMappedFileTest, MapFile) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  FilePath file_path = temp_dir.GetPath().Append("file");
+  constexpr std::string_view kContents = "12345";
+  ASSERT_TRUE(WriteFile(file_path, kContents));
+
+  File file(file_path, File::FLAG_OPEN | File::FLAG_READ);
+  MemoryMappedFile map;
+  ASSERT_TRUE(map.Initialize(std::move(file)));
+  EXPECT_EQ(map.bytes().size(), kContents.size());
+}
+
+TEST(MemoryMappedFileTest, InvalidFile) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  MemoryMappedFile map;
+  EXPECT_FALSE(map.Initialize(temp_dir.GetPath().Append("not_exist")));
+  EXPECT_FALSE(map.IsValid());
+
+  FilePath file_path = temp_dir.GetPath().Append("empty");
+  ASSERT_TRUE(WriteFile(file_path, std::string_view()));
+  EXPECT_FALSE(map.Initialize(file_path));
+  EXPECT_FALSE(map.IsValid());
+}
+
+}  // namespace tachyon::base
@@ -10,8 +10,26 @@
 #include "tachyon/base/functional/functor_traits.h"
 #include "tachyon/base/openmp_util.h"
 
+#if defined(TACHYON_HAS_WORK_STEALING)
+#include "tachyon/base/threading/work_stealing_thread_pool.h"
+#endif  // defined(TACHYON_HAS_WORK_STEALING)
+
 namespace tachyon::base {
 
+// Calls |callback(i)| for every i in [0, |n|) in parallel. With the work
+// stealing thread pool, |grain_size| is the number of indices a task runs at
+// least, where 0 lets the pool choose it, and a nested call shares the
+// workers with the outer one. Otherwise, it's a plain OpenMP loop.
+template <typename Callable>
+void ParallelFor(size_t n, Callable callback, size_t grain_size = 0) {
+#if defined(TACHYON_HAS_WORK_STEALING)
+  WorkStealingThreadPool::GetInstance()->ParallelFor(0, n, grain_size,
+                                                     std::move(callback));
+#else
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) { callback(i); }
+#endif  // defined(TACHYON_HAS_WORK_STEALING)
+}
+
 template <typename T>
 using ParallelizeCallback1 = std::function<void(absl::Span<T>)>;
 template <typename T>
@@ -32,19 +50,23 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
                             Callable callback) {
   if (chunk_size == 0) return;
   size_t num_chunks = (std::size(container) + chunk_size - 1) / chunk_size;
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
-    size_t len = i == num_chunks - 1 ? std::size(container) - i * chunk_size
-                                     : chunk_size;
-    SpanTy chunk(std::data(container) + i * chunk_size, len);
-    if constexpr (ArgNum == 1) {
-      callback(chunk);
-    } else if constexpr (ArgNum == 2) {
-      callback(chunk, i);
-    } else {
-      static_assert(ArgNum == 3);
-      callback(chunk, i, chunk_size);
-    }
-  }
+  ParallelFor(
+      num_chunks,
+      [&container, chunk_size, num_chunks, &callback](size_t i) {
+        size_t len = i == num_chunks - 1
+                         ? std::size(container) - i * chunk_size
+                         : chunk_size;
+        SpanTy chunk(std::data(container) + i * chunk_size, len);
+        if constexpr (ArgNum == 1) {
+          callback(chunk);
+        } else if constexpr (ArgNum == 2) {
+          callback(chunk, i);
+        } else {
+          static_assert(ArgNum == 3);
+          callback(chunk, i, chunk_size);
+        }
+      },
+      /*grain_size=*/1);
 }
 
 // Splits the |container| into threads and executes |callback| in parallel.
@@ -76,19 +98,23 @@ std::vector<ReturnType> ParallelizeMapByChunkSize(Container& container,
   if (chunk_size == 0) return {};
   size_t num_chunks = (std::size(container) + chunk_size - 1) / chunk_size;
   std::vector<ReturnType> values(num_chunks);
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
-    size_t len = i == num_chunks - 1 ? std::size(container) - i * chunk_size
-                                     : chunk_size;
-    SpanTy chunk(std::data(container) + i * chunk_size, len);
-    if constexpr (ArgNum == 1) {
-      values[i] = callback(chunk);
-    } else if constexpr (ArgNum == 2) {
-      values[i] = callback(chunk, i);
-    } else {
-      static_assert(ArgNum == 3);
-      values[i] = callback(chunk, i, chunk_size);
-    }
-  }
+  ParallelFor(
+      num_chunks,
+      [&container, chunk_size, num_chunks, &callback, &values](size_t i) {
+        size_t len = i == num_chunks - 1
+                         ? std::size(container) - i * chunk_size
+                         : chunk_size;
+        SpanTy chunk(std::data(container) + i * chunk_size, len);
+        if constexpr (ArgNum == 1) {
+          values[i] = callback(chunk);
+        } else if constexpr (ArgNum == 2) {
+          values[i] = callback(chunk, i);
+        } else {
+          static_assert(ArgNum == 3);
+          values[i] = callback(chunk, i, chunk_size);
+        }
+      },
+      /*grain_size=*/1);
   return values;
 }
 
@@ -0,0 +1,208 @@
+#include "tachyon/base/threading/work_stealing_thread_pool.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/device/numa.h"
+
+#if BUILDFLAG(IS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace tachyon::base {
+
+namespace {
+
+// The pool the current thread works for and its index there, which are only
+// set on the workers.
+thread_local WorkStealingThreadPool* g_current_pool = nullptr;
+thread_local size_t g_current_worker_index = 0;
+
+void PinCurrentThreadToCore(size_t core) {
+#if BUILDFLAG(IS_LINUX)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(core, &cpu_set);
+  int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (ret != 0) {
+    LOG(WARNING) << "Failed to pin a thread to core " << core;
+  }
+#else
+  NOTIMPLEMENTED();
+#endif
+}
+
+}  // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(const Options& options) {
+  size_t num_threads = options.num_threads;
+  if (num_threads == 0) {
+    num_threads = std::max(size_t{std::thread::hardware_concurrency()},
+                           size_t{1});
+  }
+  size_t num_workers = num_threads - 1;
+  queues_.reserve(num_workers + 1);
+  for (size_t i = 0; i < num_workers + 1; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+
+  int num_numa_nodes = 1;
+  if (!options.pin_threads && device::NUMAEnabled()) {
+    num_numa_nodes = device::NUMANumNodes();
+  }
+  workers_.resize(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_[i].numa_node = num_numa_nodes > 1
+                                ? static_cast<int>(i % num_numa_nodes)
+                                : device::kNUMANoAffinity;
+  }
+  for (size_t i = 0; i < num_workers; ++i) {
+    std::vector<size_t>& victims = workers_[i].victims;
+    for (size_t j = 1; j < num_workers; ++j) {
+      size_t victim = (i + j) % num_workers;
+      if (workers_[victim].numa_node == workers_[i].numa_node) {
+        victims.push_back(victim);
+      }
+    }
+    for (size_t j = 1; j < num_workers; ++j) {
+      size_t victim = (i + j) % num_workers;
+      if (workers_[victim].numa_node != workers_[i].numa_node) {
+        victims.push_back(victim);
+      }
+    }
+    victims.push_back(num_workers);
+  }
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_[i].thread = std::thread(&WorkStealingThreadPool::RunWorker, this,
+                                     i, options.pin_threads);
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopped_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (Worker& worker : workers_) {
+    worker.thread.join();
+  }
+}
+
+// static
+WorkStealingThreadPool* WorkStealingThreadPool::GetInstance() {
+  static NoDestructor<WorkStealingThreadPool> pool(Options{});
+  return pool.get();
+}
+
+void WorkStealingThreadPool::Spawn(TaskGroup* group,
+                                   std::function<void()> task) {
+  group->num_pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+  size_t queue_index =
+      g_current_pool == this ? g_current_worker_index : workers_.size();
+  Queue& queue = *queues_[queue_index];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back({std::move(task), group});
+  }
+  num_queued_tasks_.fetch_add(1);
+  if (num_sleeping_workers_.load() > 0) {
+    // NOTE: Taking the lock makes sure that a worker going to sleep either
+    // sees the task above or is already waiting for the notification.
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    sleep_cv_.notify_one();
+  }
+}
+
+void WorkStealingThreadPool::Wait(TaskGroup* group) {
+  while (!group->IsDone()) {
+    Task task;
+    if (TryPopTask(&task)) {
+      RunTask(task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void WorkStealingThreadPool::RunWorker(size_t index, bool pin_thread) {
+  g_current_pool = this;
+  g_current_worker_index = index;
+  if (pin_thread) {
+    // NOTE: The calling thread usually runs on the first core, so the
+    // workers start from the next one.
+    PinCurrentThreadToCore((index + 1) %
+                           std::max(std::thread::hardware_concurrency(), 1u));
+  } else if (workers_[index].numa_node != device::kNUMANoAffinity) {
+    device::NUMASetThreadNodeAffinity(workers_[index].numa_node);
+  }
+
+  while (true) {
+    Task task;
+    if (TryPopTask(&task)) {
+      RunTask(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    num_sleeping_workers_.fetch_add(1);
+    sleep_cv_.wait(lock, [this]() {
+      return stopped_ || num_queued_tasks_.load() > 0;
+    });
+    num_sleeping_workers_.fetch_sub(1);
+    if (stopped_) return;
+  }
+}
+
+bool WorkStealingThreadPool::TryPopTask(Task* task) {
+  if (g_current_pool == this) {
+    Queue& queue = *queues_[g_current_worker_index];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        *task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        num_queued_tasks_.fetch_sub(1);
+        return true;
+      }
+    }
+    for (size_t victim : workers_[g_current_worker_index].victims) {
+      if (TryStealTask(victim, task)) return true;
+    }
+    return false;
+  }
+
+  // A thread that isn't a worker takes the latest task it has spawned first
+  // and steals from the workers after that.
+  Queue& queue = *queues_[workers_.size()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      *task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      num_queued_tasks_.fetch_sub(1);
+      return true;
+    }
+  }
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    if (TryStealTask(i, task)) return true;
+  }
+  return false;
+}
+
+bool WorkStealingThreadPool::TryStealTask(size_t queue_index, Task* task) {
+  Queue& queue = *queues_[queue_index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) return false;
+  *task = std::move(queue.tasks.front());
+  queue.tasks.pop_front();
+  num_queued_tasks_.fetch_sub(1);
+  return true;
+}
+
+void WorkStealingThreadPool::RunTask(Task& task) {
+  task.callback();
+  task.group->num_pending_tasks_.fetch_sub(1, std::memory_order_release);
+}
+
+}  // namespace tachyon::base
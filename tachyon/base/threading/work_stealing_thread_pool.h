@@ -0,0 +1,194 @@
+#ifndef TACHYON_BASE_THREADING_WORK_STEALING_THREAD_POOL_H_
+#define TACHYON_BASE_THREADING_WORK_STEALING_THREAD_POOL_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// A fork-join thread pool where every worker owns a deque of tasks. A worker
+// pushes and pops tasks at the back of its own deque and, when it runs out
+// of tasks, steals from the front of the others, preferring the workers on
+// the same NUMA node. A thread that isn't a worker pushes tasks into a shared
+// queue instead.
+//
+// A thread waiting for a |TaskGroup| runs the pending tasks instead of
+// blocking, so a nested |ParallelFor()| inside a task shares the workers with
+// the outer one rather than spawning another team of threads. The calling
+// thread takes part in the work as well, so a pool of n threads runs n - 1
+// workers.
+//
+//   WorkStealingThreadPool* pool = WorkStealingThreadPool::GetInstance();
+//   pool->ParallelFor(0, n, [&](size_t i) { v[i] *= 2; });
+//   F sum = pool->ParallelReduce(
+//       0, n, /*grain_size=*/1024, F::Zero(),
+//       [&](size_t begin, size_t end) {
+//         F ret = F::Zero();
+//         for (size_t i = begin; i < end; ++i) ret += v[i];
+//         return ret;
+//       },
+//       [](F a, const F& b) { return a += b; });
+class TACHYON_EXPORT WorkStealingThreadPool {
+ public:
+  struct Options {
+    // The number of threads including the calling thread. If it's 0, the
+    // number of hardware threads is used.
+    size_t num_threads = 0;
+    // If true, every worker is pinned to a core. Otherwise, a worker is only
+    // bound to a NUMA node if there is more than one.
+    bool pin_threads = false;
+  };
+
+  // Tracks the tasks spawned by |Spawn()| so that |Wait()| returns after all
+  // of them finish, including the ones they spawn into the same group.
+  class TaskGroup {
+   public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    ~TaskGroup() = default;
+
+    bool IsDone() const {
+      return num_pending_tasks_.load(std::memory_order_acquire) == 0;
+    }
+
+   private:
+    friend class WorkStealingThreadPool;
+
+    std::atomic<size_t> num_pending_tasks_ = 0;
+  };
+
+  explicit WorkStealingThreadPool(const Options& options);
+  WorkStealingThreadPool(const WorkStealingThreadPool& other) = delete;
+  WorkStealingThreadPool& operator=(const WorkStealingThreadPool& other) =
+      delete;
+  ~WorkStealingThreadPool();
+
+  // Returns the process-wide pool with the default |Options|.
+  static WorkStealingThreadPool* GetInstance();
+
+  size_t num_threads() const { return workers_.size() + 1; }
+
+  // Schedules |task| in |group|. |task| may run on any thread, including the
+  // one that calls |Wait()|.
+  void Spawn(TaskGroup* group, std::function<void()> task);
+
+  // Runs the pending tasks until every task of |group| finishes.
+  void Wait(TaskGroup* group);
+
+  // Calls |callback(i)| for every i in [|begin|, |end|). The range is split
+  // in halves recursively until it is no longer than |grain_size|, so that
+  // idle workers steal the largest remaining halves. If |grain_size| is 0,
+  // it is chosen to make about 4 ranges per thread.
+  template <typename Callable>
+  void ParallelFor(size_t begin, size_t end, size_t grain_size,
+                   Callable callback) {
+    if (begin >= end) return;
+    if (grain_size == 0) grain_size = GetDefaultGrainSize(end - begin);
+    TaskGroup group;
+    RunRange(&group, begin, end, grain_size, callback);
+    Wait(&group);
+  }
+
+  template <typename Callable>
+  void ParallelFor(size_t begin, size_t end, Callable callback) {
+    ParallelFor(begin, end, 0, std::move(callback));
+  }
+
+  // Splits [|begin|, |end|) into ranges of |grain_size|, maps each of them
+  // by |map(range_begin, range_end)| in parallel and folds the results with
+  // |reduce(acc, value)| starting from |identity|. The results are folded in
+  // the order of the ranges, so the result doesn't depend on the schedule.
+  template <typename T, typename MapCallable, typename ReduceCallable>
+  T ParallelReduce(size_t begin, size_t end, size_t grain_size, T identity,
+                   MapCallable map, ReduceCallable reduce) {
+    if (begin >= end) return identity;
+    if (grain_size == 0) grain_size = GetDefaultGrainSize(end - begin);
+    size_t num_ranges = (end - begin + grain_size - 1) / grain_size;
+    std::vector<T> values(num_ranges, identity);
+    ParallelFor(0, num_ranges, 1, [&](size_t i) {
+      size_t range_begin = begin + i * grain_size;
+      values[i] = map(range_begin, std::min(range_begin + grain_size, end));
+    });
+    T ret = std::move(identity);
+    for (T& value : values) {
+      ret = reduce(std::move(ret), std::move(value));
+    }
+    return ret;
+  }
+
+ private:
+  struct Task {
+    std::function<void()> callback;
+    TaskGroup* group;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  struct Worker {
+    std::thread thread;
+    // The NUMA node the worker is bound to, or |device::kNUMANoAffinity|.
+    int numa_node;
+    // The indices of the queues to steal from, the ones of the workers on
+    // the same NUMA node first.
+    std::vector<size_t> victims;
+  };
+
+  size_t GetDefaultGrainSize(size_t size) const {
+    return std::max(size / (4 * num_threads()), size_t{1});
+  }
+
+  template <typename Callable>
+  void RunRange(TaskGroup* group, size_t begin, size_t end, size_t grain_size,
+                Callable& callback) {
+    while (end - begin > grain_size) {
+      size_t mid = begin + (end - begin) / 2;
+      Spawn(group, [this, group, mid, end, grain_size, &callback]() {
+        RunRange(group, mid, end, grain_size, callback);
+      });
+      end = mid;
+    }
+    for (size_t i = begin; i < end; ++i) {
+      callback(i);
+    }
+  }
+
+  void RunWorker(size_t index, bool pin_thread);
+
+  // Pops a task from the queue of the current thread or steals one from the
+  // others. Returns false if there is no task.
+  bool TryPopTask(Task* task);
+  bool TryStealTask(size_t queue_index, Task* task);
+  void RunTask(Task& task);
+
+  // The queues of the workers followed by the shared queue of the threads
+  // that aren't workers.
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<Worker> workers_;
+
+  // The number of tasks in |queues_|, which the idle workers sleep on.
+  std::atomic<size_t> num_queued_tasks_ = 0;
+  std::atomic<size_t> num_sleeping_workers_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool stopped_ = false;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_THREADING_WORK_STEALING_THREAD_POOL_H_
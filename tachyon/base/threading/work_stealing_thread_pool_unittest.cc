@@ -0,0 +1,92 @@
+#include "tachyon/base/threading/work_stealing_thread_pool.h"
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+namespace {
+
+class WorkStealingThreadPoolTest : public testing::Test {
+ public:
+  WorkStealingThreadPoolTest() : pool_({/*num_threads=*/4}) {}
+
+ protected:
+  WorkStealingThreadPool pool_;
+};
+
+}  // namespace
+
+TEST_F(WorkStealingThreadPoolTest, NumThreads) {
+  EXPECT_EQ(pool_.num_threads(), 4);
+  EXPECT_GE(WorkStealingThreadPool::GetInstance()->num_threads(), 1);
+}
+
+TEST_F(WorkStealingThreadPoolTest, Spawn) {
+  std::atomic<size_t> sum = 0;
+  WorkStealingThreadPool::TaskGroup group;
+  for (size_t i = 0; i < 100; ++i) {
+    pool_.Spawn(&group, [&sum, i]() { sum += i; });
+  }
+  pool_.Wait(&group);
+  EXPECT_TRUE(group.IsDone());
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST_F(WorkStealingThreadPoolTest, ParallelFor) {
+  for (size_t grain_size : {0, 1, 7, 1000}) {
+    std::vector<size_t> values(1000, 0);
+    pool_.ParallelFor(0, values.size(), grain_size,
+                      [&values](size_t i) { values[i] += i; });
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(values[i], i);
+    }
+  }
+
+  size_t count = 0;
+  pool_.ParallelFor(3, 3, [&count](size_t i) { ++count; });
+  EXPECT_EQ(count, 0);
+}
+
+TEST_F(WorkStealingThreadPoolTest, NestedParallelFor) {
+  std::vector<std::vector<size_t>> values(16, std::vector<size_t>(64, 0));
+  pool_.ParallelFor(0, values.size(), 1, [this, &values](size_t i) {
+    pool_.ParallelFor(0, values[i].size(), 1,
+                      [&values, i](size_t j) { values[i][j] = i * j; });
+  });
+  for (size_t i = 0; i < values.size(); ++i) {
+    for (size_t j = 0; j < values[i].size(); ++j) {
+      ASSERT_EQ(values[i][j], i * j);
+    }
+  }
+}
+
+TEST_F(WorkStealingThreadPoolTest, ParallelReduce) {
+  std::vector<size_t> values(1001);
+  std::iota(values.begin(), values.end(), 0);
+  for (size_t grain_size : {0, 1, 10, 2000}) {
+    size_t sum = pool_.ParallelReduce(
+        0, values.size(), grain_size, size_t{0},
+        [&values](size_t begin, size_t end) {
+          return std::accumulate(values.begin() + begin, values.begin() + end,
+                                 size_t{0});
+        },
+        [](size_t a, size_t b) { return a + b; });
+    EXPECT_EQ(sum, 500500);
+  }
+
+  // The results are folded in the order of the ranges.
+  std::vector<size_t> order = pool_.ParallelReduce(
+      0, 10, 1, std::vector<size_t>(),
+      [](size_t begin, size_t end) { return std::vector<size_t>{begin}; },
+      [](std::vector<size_t> a, std::vector<size_t> b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+      });
+  EXPECT_EQ(order, std::vector<size_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+}  // namespace tachyon::base
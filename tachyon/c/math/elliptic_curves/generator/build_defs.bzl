@@ -43,6 +43,7 @@ def generate_ec_points(
         fr_limb_nums,
         g1_deps,
         g1_gpu_deps,
+        g2_deps,
         g1_msm_kernels_deps = []):
     for n in [
         ("gen_fq_hdr", "fq.h"),
@@ -54,8 +55,13 @@ def generate_ec_points(
         ("gen_fq_prime_field_traits", "fq_prime_field_traits.h"),
         ("gen_fr_prime_field_traits", "fr_prime_field_traits.h"),
         ("gen_g1_point_traits", "g1_point_traits.h"),
+        ("gen_g2_hdr", "g2.h"),
+        ("gen_g2_src", "g2.cc"),
+        ("gen_g2_point_traits", "g2_point_traits.h"),
         ("gen_msm_hdr", "msm.h"),
         ("gen_msm_src", "msm.cc"),
+        ("gen_msm_g2_hdr", "msm_g2.h"),
+        ("gen_msm_g2_src", "msm_g2.cc"),
         ("gen_msm_gpu_hdr", "msm_gpu.h"),
         ("gen_msm_gpu_src", "msm_gpu.cc"),
     ]:
@@ -108,6 +114,20 @@ def generate_ec_points(
         ],
     )
 
+    tachyon_cc_library(
+        name = "g2",
+        hdrs = [
+            "g2.h",
+            "g2_point_traits.h",
+        ],
+        srcs = ["g2.cc"],
+        deps = g2_deps + [
+            ":fq",
+            ":fr",
+            "//tachyon/cc/math/elliptic_curves:point_traits_forward",
+        ],
+    )
+
     tachyon_cc_library(
         name = "msm",
         hdrs = ["msm.h"],
@@ -118,6 +138,16 @@ def generate_ec_points(
         ],
     )
 
+    tachyon_cc_library(
+        name = "msm_g2",
+        hdrs = ["msm_g2.h"],
+        srcs = ["msm_g2.cc"],
+        deps = [
+            ":g2",
+            "//tachyon/c/math/elliptic_curves/msm",
+        ],
+    )
+
     if name != "bls12_381":
         # NOTE(chokobole): bls12_381 scalar field causes a compliation error at PrimeFieldGpu::MulInPlace().
         tachyon_cuda_library(
@@ -43,8 +43,13 @@ struct GenerationConfig : public build::CcWriter {
   int GenerateG1TraitsHdr() const;
   int GenerateG1Hdr() const;
   int GenerateG1Src() const;
+  int GenerateG2TraitsHdr() const;
+  int GenerateG2Hdr() const;
+  int GenerateG2Src() const;
   int GenerateMSMHdr() const;
   int GenerateMSMSrc() const;
+  int GenerateMSMG2Hdr() const;
+  int GenerateMSMG2Src() const;
   int GenerateMSMGpuHdr() const;
   int GenerateMSMGpuSrc() const;
 };
@@ -733,6 +738,190 @@ int GenerationConfig::GenerateG1TraitsHdr() const {
   return WriteHdr(content, false);
 }
 
+int GenerationConfig::GenerateG2Hdr() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include \"tachyon/c/export.h\"",
+      "#include \"%{header_path}\"",
+      "",
+      "struct tachyon_%{type}_fq2 {",
+      "  tachyon_%{type}_fq c0;",
+      "  tachyon_%{type}_fq c1;",
+      "};",
+      "",
+      "struct __attribute__((aligned(32))) %{g2}_affine {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  // needs to occupy 32 byte",
+      "  // NOTE(chokobole): See LimbsAlignment() in tachyon/math/base/big_int.h",
+      "  bool infinity;",
+      "};",
+      "",
+      "struct %{g2}_projective {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "};",
+      "",
+      "struct %{g2}_jacobian {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "};",
+      "",
+      "struct %{g2}_xyzz {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 zz;",
+      "  tachyon_%{type}_fq2 zzz;",
+      "};",
+      "",
+      "struct %{g2}_point2 {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "};",
+      "",
+      "struct %{g2}_point3 {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "};",
+      "",
+      "struct %{g2}_point4 {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "  tachyon_%{type}_fq2 w;",
+      "};",
+      "",
+      "%{extern_c_front}",
+      "",
+      "TACHYON_C_EXPORT void %{g2}_init();",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  base::FilePath hdr_path = GetHdrPath();
+  std::string header_path = hdr_path.DirName().Append("fq.h").value();
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_path}", header_path},
+                       {"%{type}", type},
+                       {"%{g2}", absl::Substitute("tachyon_$0_g2", type)},
+                   });
+  return WriteHdr(content, true);
+}
+
+int GenerationConfig::GenerateG2Src() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "void %{g2}_init() {",
+      "  tachyon::math::%{type}::G2Curve::Init();",
+      "}",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                       {"%{g2}", absl::Substitute("tachyon_$0_g2", type)},
+                   });
+  return WriteSrc(content);
+}
+
+int GenerationConfig::GenerateG2TraitsHdr() const {
+  std::vector<std::string_view> tpl = {
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fr.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "#include \"tachyon/cc/math/elliptic_curves/point_traits_forward.h\"",
+      "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "namespace tachyon::cc::math {",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2AffinePoint> {",
+      "  using CPoint = tachyon_%{type}_g2_point2;",
+      "  using CCurvePoint = tachyon_%{type}_g2_affine;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2ProjectivePoint> {",
+      "  using CPoint = tachyon_%{type}_g2_point3;",
+      "  using CCurvePoint = tachyon_%{type}_g2_projective;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2JacobianPoint> {",
+      "  using CPoint = tachyon_%{type}_g2_point3;",
+      "  using CCurvePoint = tachyon_%{type}_g2_jacobian;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2PointXYZZ> {",
+      "  using CPoint = tachyon_%{type}_g2_point4;",
+      "  using CCurvePoint = tachyon_%{type}_g2_xyzz;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_affine> {",
+      "  using Point = tachyon::math::Point2<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePoint = tachyon::math::%{type}::G2AffinePoint;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_projective> {",
+      "  using Point = tachyon::math::Point3<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePoint = tachyon::math::%{type}::G2ProjectivePoint;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_jacobian> {",
+      "  using Point = tachyon::math::Point3<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePoint = tachyon::math::%{type}::G2JacobianPoint;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_xyzz> {",
+      "  using Point = tachyon::math::Point4<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePoint = tachyon::math::%{type}::G2PointXYZZ;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_point2> {",
+      "  using Point = tachyon::math::Point2<tachyon::math::%{type}::Fq2>;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_point3> {",
+      "  using Point = tachyon::math::Point3<tachyon::math::%{type}::Fq2>;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_point4> {",
+      "  using Point = tachyon::math::Point4<tachyon::math::%{type}::Fq2>;",
+      "};",
+      "",
+      "}  // namespace tachyon::cc::math",
+  };
+
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteHdr(content, false);
+}
+
 int GenerationConfig::GenerateMSMHdr() const {
   // clang-format off
   std::string_view tpl[] = {
@@ -744,6 +933,7 @@ int GenerationConfig::GenerateMSMHdr() const {
       "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g1.h\"",
       "",
       "typedef struct tachyon_%{type}_g1_msm* tachyon_%{type}_g1_msm_ptr;",
+      "typedef struct tachyon_%{type}_g1_msm_bases* tachyon_%{type}_g1_msm_bases_ptr;",
       "",
       "%{extern_c_front}",
       "",
@@ -758,6 +948,24 @@ int GenerationConfig::GenerateMSMHdr() const {
       "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm(",
       "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_affine* bases,",
       "    const tachyon_%{type}_fr* scalars, size_t size);",
+      "",
+      "// Registers |bases| once so that they can be shared by many MSMs without",
+      "// being converted or copied again. |bases| can be freed after this returns.",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_point2(",
+      "    const tachyon_%{type}_g1_point2* bases, size_t size);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_affine(",
+      "    const tachyon_%{type}_g1_affine* bases, size_t size);",
+      "",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g1_destroy_msm_bases(tachyon_%{type}_g1_msm_bases_ptr bases);",
+      "",
+      "TACHYON_C_EXPORT size_t tachyon_%{type}_g1_msm_bases_size(tachyon_%{type}_g1_msm_bases_ptr bases);",
+      "",
+      "// Runs an MSM over the first |size| points of |bases|. |size| must not be",
+      "// greater than the number of the registered points.",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_with_bases(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, tachyon_%{type}_g1_msm_bases_ptr bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size);",
   };
   // clang-format on
   std::string tpl_content = absl::StrJoin(tpl, "\n");
@@ -781,6 +989,10 @@ int GenerationConfig::GenerateMSMSrc() const {
       "  using tachyon::c::math::MSMApi<tachyon::math::%{type}::G1AffinePoint>::MSMApi;",
       "};",
       "",
+      "struct tachyon_%{type}_g1_msm_bases : public tachyon::c::math::MSMBases<tachyon::math::%{type}::G1AffinePoint> {",
+      "  using tachyon::c::math::MSMBases<tachyon::math::%{type}::G1AffinePoint>::MSMBases;",
+      "};",
+      "",
       "tachyon_%{type}_g1_msm_ptr tachyon_%{type}_g1_create_msm(uint8_t degree) {",
       "  return new tachyon_%{type}_g1_msm(degree);",
       "}",
@@ -802,6 +1014,112 @@ int GenerationConfig::GenerateMSMSrc() const {
       "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G1JacobianPoint>(",
       "      *ptr, bases, scalars, size);",
       "}",
+      "",
+      "tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_point2(",
+      "    const tachyon_%{type}_g1_point2* bases, size_t size) {",
+      "  return new tachyon_%{type}_g1_msm_bases(bases, size);",
+      "}",
+      "",
+      "tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_affine(",
+      "    const tachyon_%{type}_g1_affine* bases, size_t size) {",
+      "  return new tachyon_%{type}_g1_msm_bases(bases, size);",
+      "}",
+      "",
+      "void tachyon_%{type}_g1_destroy_msm_bases(tachyon_%{type}_g1_msm_bases_ptr bases) {",
+      "  delete bases;",
+      "}",
+      "",
+      "size_t tachyon_%{type}_g1_msm_bases_size(tachyon_%{type}_g1_msm_bases_ptr bases) {",
+      "  return bases->bases.size();",
+      "}",
+      "",
+      "tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_with_bases(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, tachyon_%{type}_g1_msm_bases_ptr bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size) {",
+      "  return tachyon::c::math::DoMSMWithBases<tachyon::math::%{type}::G1JacobianPoint>(",
+      "      *ptr, *bases, scalars, size);",
+      "}",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteSrc(content);
+}
+
+int GenerationConfig::GenerateMSMG2Hdr() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include <stddef.h>",
+      "#include <stdint.h>",
+      "",
+      "#include \"tachyon/c/export.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fr.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "typedef struct tachyon_%{type}_g2_msm* tachyon_%{type}_g2_msm_ptr;",
+      "",
+      "%{extern_c_front}",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g2_msm_ptr tachyon_%{type}_g2_create_msm(uint8_t degree);",
+      "",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g2_destroy_msm(tachyon_%{type}_g2_msm_ptr ptr);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_point2_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_point2* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_affine_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_affine* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size);",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteHdr(content, true);
+}
+
+int GenerationConfig::GenerateMSMG2Src() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g2_point_traits.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/msm/msm.h\"",
+      "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "struct tachyon_%{type}_g2_msm : public tachyon::c::math::MSMApi<tachyon::math::%{type}::G2AffinePoint> {",
+      "  using tachyon::c::math::MSMApi<tachyon::math::%{type}::G2AffinePoint>::MSMApi;",
+      "};",
+      "",
+      "tachyon_%{type}_g2_msm_ptr tachyon_%{type}_g2_create_msm(uint8_t degree) {",
+      "  return new tachyon_%{type}_g2_msm(degree);",
+      "}",
+      "",
+      "void tachyon_%{type}_g2_destroy_msm(tachyon_%{type}_g2_msm_ptr ptr) {",
+      "  delete ptr;",
+      "}",
+      "",
+      "tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_point2_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_point2* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size) {",
+      "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G2JacobianPoint>(",
+      "      *ptr, bases, scalars, size);",
+      "}",
+      "",
+      "tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_affine_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_affine* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size) {",
+      "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G2JacobianPoint>(",
+      "      *ptr, bases, scalars, size);",
+      "}",
   };
   // clang-format on
   std::string tpl_content = absl::StrJoin(tpl, "\n");
@@ -957,6 +1275,16 @@ int RealMain(int argc, char** argv) {
     return config.GenerateG1Src();
   } else if (base::EndsWith(config.out.value(), "g1_point_traits.h")) {
     return config.GenerateG1TraitsHdr();
+  } else if (base::EndsWith(config.out.value(), "msm_g2.h")) {
+    return config.GenerateMSMG2Hdr();
+  } else if (base::EndsWith(config.out.value(), "msm_g2.cc")) {
+    return config.GenerateMSMG2Src();
+  } else if (base::EndsWith(config.out.value(), "g2.h")) {
+    return config.GenerateG2Hdr();
+  } else if (base::EndsWith(config.out.value(), "g2.cc")) {
+    return config.GenerateG2Src();
+  } else if (base::EndsWith(config.out.value(), "g2_point_traits.h")) {
+    return config.GenerateG2TraitsHdr();
   } else if (base::EndsWith(config.out.value(), "msm.h")) {
     return config.GenerateMSMHdr();
   } else if (base::EndsWith(config.out.value(), "msm.cc")) {
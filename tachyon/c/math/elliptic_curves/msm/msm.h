@@ -1,9 +1,17 @@
 #ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
 #define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
 
+#include <stddef.h>
+
 #include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "tachyon/base/console/console_stream.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/c/math/elliptic_curves/msm/msm_input_provider.h"
 #include "tachyon/cc/math/elliptic_curves/point_conversions.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
@@ -32,6 +40,28 @@ struct MSMApi {
   }
 };
 
+// Bases that are converted once and shared by many MSMs, e.g., the SRS of a
+// polynomial commitment scheme. An MSM over them neither converts nor copies
+// the bases.
+template <typename Point>
+struct MSMBases {
+  std::vector<Point> bases;
+
+  template <typename CPoint>
+  MSMBases(const CPoint* bases_in, size_t size) : bases(size) {
+    using CCurvePoint = typename cc::math::PointTraits<Point>::CCurvePoint;
+
+    if constexpr (std::is_same_v<CPoint, CCurvePoint>) {
+      const Point* points = reinterpret_cast<const Point*>(bases_in);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+        bases[i] = points[i];
+      }
+    } else {
+      MSMInputProvider<Point>::ConvertBases(bases_in, size, bases.data());
+    }
+  }
+};
+
 template <
     typename RetPoint, typename Point, typename CPoint, typename CScalarField,
     typename CRetPoint = typename cc::math::PointTraits<RetPoint>::CCurvePoint,
@@ -48,6 +78,27 @@ CRetPoint* DoMSM(MSMApi<Point>& msm_api, const CPoint* bases,
   return cret;
 }
 
+// Runs an MSM over the first |size| points of |bases|.
+template <
+    typename RetPoint, typename Point, typename CScalarField,
+    typename CRetPoint = typename cc::math::PointTraits<RetPoint>::CCurvePoint,
+    typename Bucket = typename tachyon::math::VariableBaseMSM<Point>::Bucket>
+CRetPoint* DoMSMWithBases(MSMApi<Point>& msm_api, const MSMBases<Point>& bases,
+                          const CScalarField* scalars, size_t size) {
+  using ScalarField = typename Point::ScalarField;
+
+  CHECK_LE(size, bases.bases.size());
+  Bucket bucket;
+  CHECK(msm_api.msm.Run(
+      absl::MakeConstSpan(bases.bases).subspan(0, size),
+      absl::MakeConstSpan(reinterpret_cast<const ScalarField*>(scalars), size),
+      &bucket));
+  auto ret = tachyon::math::ConvertPoint<RetPoint>(bucket);
+  CRetPoint* cret = new CRetPoint();
+  cc::math::ToCPoint3(ret, cret);
+  return cret;
+}
+
 }  // namespace tachyon::c::math
 
 #endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
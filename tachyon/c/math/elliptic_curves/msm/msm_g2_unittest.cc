@@ -0,0 +1,71 @@
+#include "tachyon/c/math/elliptic_curves/bn/bn254/msm_g2.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g2_point_traits.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+// The last one is large enough to accumulate the buckets in affine
+// coordinates.
+constexpr size_t kNums[] = {
+    32, 5, VariableBaseMSM<bn254::G2AffinePoint>::kBatchAffineThreshold};
+
+class MSMG2Test : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    tachyon_bn254_g2_init();
+
+    size_t max_num = *std::max_element(std::begin(kNums), std::end(kNums));
+    msm_ = tachyon_bn254_g2_create_msm(base::bits::Log2Ceiling(max_num));
+    for (size_t n : kNums) {
+      test_sets_.push_back(VariableBaseMSMTestSet<bn254::G2AffinePoint>::Random(
+          n, VariableBaseMSMMethod::kNaive));
+    }
+  }
+
+  static void TearDownTestSuite() { tachyon_bn254_g2_destroy_msm(msm_); }
+
+ protected:
+  static tachyon_bn254_g2_msm_ptr msm_;
+  static std::vector<VariableBaseMSMTestSet<bn254::G2AffinePoint>> test_sets_;
+};
+
+tachyon_bn254_g2_msm_ptr MSMG2Test::msm_;
+std::vector<VariableBaseMSMTestSet<bn254::G2AffinePoint>> MSMG2Test::test_sets_;
+
+}  // namespace
+
+TEST_F(MSMG2Test, MSMPoint2) {
+  for (const VariableBaseMSMTestSet<bn254::G2AffinePoint>& t : test_sets_) {
+    std::unique_ptr<tachyon_bn254_g2_jacobian> ret;
+    std::vector<Point2<bn254::Fq2>> bases = base::CreateVector(
+        t.bases.size(), [&t](size_t i) {
+          return Point2<bn254::Fq2>(t.bases[i].x(), t.bases[i].y());
+        });
+    ret.reset(tachyon_bn254_g2_point2_msm(
+        msm_, reinterpret_cast<const tachyon_bn254_g2_point2*>(bases.data()),
+        reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(*reinterpret_cast<bn254::G2JacobianPoint*>(ret.get()),
+              t.answer.ToJacobian());
+  }
+}
+
+TEST_F(MSMG2Test, MSMG2Affine) {
+  for (const VariableBaseMSMTestSet<bn254::G2AffinePoint>& t : test_sets_) {
+    std::unique_ptr<tachyon_bn254_g2_jacobian> ret;
+    ret.reset(tachyon_bn254_g2_affine_msm(
+        msm_, reinterpret_cast<const tachyon_bn254_g2_affine*>(t.bases.data()),
+        reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(*reinterpret_cast<bn254::G2JacobianPoint*>(ret.get()),
+              t.answer.ToJacobian());
+  }
+}
+
+}  // namespace tachyon::math
@@ -33,11 +33,21 @@ class MSMInputProvider {
     scalars_owned_.clear();
   }
 
-  void Inject(const CPoint* bases_in, const CScalarField* scalars_in,
-              size_t size) {
+  // Converts |size| points of |bases_in| into |bases_out|. A point whose x
+  // and y are both zero is regarded as the point at infinity.
+  static void ConvertBases(const CPoint* bases_in, size_t size,
+                           AffinePoint* bases_out) {
     absl::Span<const tachyon::math::Point2<BaseField>> points(
         reinterpret_cast<const tachyon::math::Point2<BaseField>*>(bases_in),
         size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      bases_out[i] =
+          AffinePoint(points[i], points[i].x.IsZero() && points[i].y.IsZero());
+    }
+  }
+
+  void Inject(const CPoint* bases_in, const CScalarField* scalars_in,
+              size_t size) {
     size_t aligned_size = 0;
     if (needs_align_) {
       aligned_size = absl::bit_ceil(size);
@@ -48,10 +58,7 @@ class MSMInputProvider {
     } else {
       bases_owned_.resize(size);
     }
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
-      bases_owned_[i] =
-          AffinePoint(points[i], points[i].x.IsZero() && points[i].y.IsZero());
-    }
+    ConvertBases(bases_in, size, bases_owned_.data());
     bases_ = absl::MakeConstSpan(bases_owned_);
 
     if (needs_align_) {
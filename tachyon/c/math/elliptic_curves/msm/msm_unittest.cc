@@ -60,4 +60,48 @@ TEST_F(MSMTest, MSMG1Affine) {
   }
 }
 
+TEST_F(MSMTest, MSMWithBases) {
+  for (const VariableBaseMSMTestSet<bn254::G1AffinePoint>& t : test_sets_) {
+    std::vector<Point2<BigInt<4>>> point2s = base::CreateVector(
+        t.bases.size(), [&t](size_t i) { return t.bases[i].ToMontgomery(); });
+    tachyon_bn254_g1_msm_bases_ptr bases_list[] = {
+        tachyon_bn254_g1_create_msm_bases_from_point2(
+            reinterpret_cast<const tachyon_bn254_g1_point2*>(point2s.data()),
+            point2s.size()),
+        tachyon_bn254_g1_create_msm_bases_from_affine(
+            reinterpret_cast<const tachyon_bn254_g1_affine*>(t.bases.data()),
+            t.bases.size()),
+    };
+    // NOTE: The registered bases don't refer to the original ones.
+    point2s.clear();
+
+    for (tachyon_bn254_g1_msm_bases_ptr bases : bases_list) {
+      EXPECT_EQ(tachyon_bn254_g1_msm_bases_size(bases), t.bases.size());
+      // The same bases are reused across MSMs.
+      for (size_t i = 0; i < 2; ++i) {
+        std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+        ret.reset(tachyon_bn254_g1_msm_with_bases(
+            msm_, bases,
+            reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+            t.scalars.size()));
+        EXPECT_EQ(cc::math::ToJacobianPoint(*ret), t.answer.ToJacobian());
+      }
+
+      // An MSM over a prefix of the bases.
+      size_t size = t.bases.size() / 2;
+      std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+      ret.reset(tachyon_bn254_g1_msm_with_bases(
+          msm_, bases,
+          reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()), size));
+      bn254::G1JacobianPoint expected = bn254::G1JacobianPoint::Zero();
+      for (size_t i = 0; i < size; ++i) {
+        expected += t.bases[i] * t.scalars[i];
+      }
+      EXPECT_EQ(cc::math::ToJacobianPoint(*ret), expected);
+
+      tachyon_bn254_g1_destroy_msm_bases(bases);
+    }
+  }
+}
+
 }  // namespace tachyon::math
@@ -1,7 +1,7 @@
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_evaluation_domain.h"
 
 #include "tachyon/c/math/polynomials/constants.h"
-#include "tachyon/math/base/rational_field.h"
+#include "tachyon/math/base/compact_rational_column.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
@@ -10,8 +10,7 @@ using namespace tachyon::math;
 
 using Domain =
     UnivariateEvaluationDomain<bn254::Fr, tachyon::c::math::kMaxDegree>;
-using RationalEvals = UnivariateEvaluations<RationalField<bn254::Fr>,
-                                            tachyon::c::math::kMaxDegree>;
+using RationalEvals = CompactRationalColumn<bn254::Fr>;
 
 tachyon_bn254_univariate_evaluation_domain*
 tachyon_bn254_univariate_evaluation_domain_create(size_t num_coeffs) {
@@ -44,8 +43,7 @@ tachyon_bn254_univariate_rational_evaluations*
 tachyon_bn254_univariate_evaluation_domain_empty_rational_evals(
     const tachyon_bn254_univariate_evaluation_domain* domain) {
   return reinterpret_cast<tachyon_bn254_univariate_rational_evaluations*>(
-      new RationalEvals(
-          reinterpret_cast<const Domain*>(domain)->Zero<RationalEvals>()));
+      new RationalEvals(reinterpret_cast<const Domain*>(domain)->size()));
 }
 
 tachyon_bn254_univariate_evaluations*
@@ -5,7 +5,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/c/math/polynomials/constants.h"
-#include "tachyon/math/base/rational_field.h"
+#include "tachyon/math/base/compact_rational_column.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
@@ -20,8 +20,7 @@ constexpr size_t kDegree = 5;
 class UnivariateEvaluationDomainTest : public FiniteFieldTest<bn254::Fr> {
  public:
   using Domain = UnivariateEvaluationDomain<bn254::Fr, c::math::kMaxDegree>;
-  using RationalEvals =
-      UnivariateEvaluations<RationalField<bn254::Fr>, c::math::kMaxDegree>;
+  using RationalEvals = CompactRationalColumn<bn254::Fr>;
 
   void SetUp() override {
     domain_ = tachyon_bn254_univariate_evaluation_domain_create(kDegree);
@@ -56,8 +55,7 @@ TEST_F(UnivariateEvaluationDomainTest, EmptyPoly) {
 }
 
 TEST_F(UnivariateEvaluationDomainTest, EmptyRationalEvals) {
-  RationalEvals cpp_evals =
-      reinterpret_cast<Domain*>(domain_)->Zero<RationalEvals>();
+  RationalEvals cpp_evals(reinterpret_cast<Domain*>(domain_)->size());
   tachyon_bn254_univariate_rational_evaluations* evals =
       tachyon_bn254_univariate_evaluation_domain_empty_rational_evals(domain_);
   EXPECT_EQ(cpp_evals, reinterpret_cast<RationalEvals&>(*evals));
@@ -3,17 +3,27 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/c/math/polynomials/constants.h"
-#include "tachyon/math/base/rational_field.h"
+#include "tachyon/math/base/compact_rational_column.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
 using namespace tachyon::math;
 
 using Evals = UnivariateEvaluations<bn254::Fr, tachyon::c::math::kMaxDegree>;
-using RationalEvals = UnivariateEvaluations<RationalField<bn254::Fr>,
-                                            tachyon::c::math::kMaxDegree>;
+using RationalEvals = CompactRationalColumn<bn254::Fr>;
+
+namespace {
+
+absl::Span<const bn254::Fr> ToSpan(const tachyon_bn254_fr* values,
+                                   size_t len) {
+  return absl::MakeConstSpan(reinterpret_cast<const bn254::Fr*>(values), len);
+}
+
+}  // namespace
 
 tachyon_bn254_univariate_rational_evaluations*
 tachyon_bn254_univariate_rational_evaluations_create() {
@@ -37,42 +47,60 @@ void tachyon_bn254_univariate_rational_evaluations_destroy(
 
 size_t tachyon_bn254_univariate_rational_evaluations_len(
     const tachyon_bn254_univariate_rational_evaluations* evals) {
-  return reinterpret_cast<const RationalEvals*>(evals)->NumElements();
+  return reinterpret_cast<const RationalEvals*>(evals)->size();
 }
 
 void tachyon_bn254_univariate_rational_evaluations_set_zero(
     tachyon_bn254_univariate_rational_evaluations* evals, size_t i) {
   // NOTE(chokobole): Boundary check is the responsibility of API callers.
-  reinterpret_cast<RationalEvals&>(*evals).at(i) =
-      RationalField<bn254::Fr>::Zero();
+  reinterpret_cast<RationalEvals&>(*evals).SetZero(i);
 }
 
 void tachyon_bn254_univariate_rational_evaluations_set_trivial(
     tachyon_bn254_univariate_rational_evaluations* evals, size_t i,
     const tachyon_bn254_fr* numerator) {
   // NOTE(chokobole): Boundary check is the responsibility of API callers.
-  reinterpret_cast<RationalEvals&>(*evals).at(i) =
-      RationalField<bn254::Fr>(reinterpret_cast<const bn254::Fr&>(*numerator));
+  reinterpret_cast<RationalEvals&>(*evals).SetTrivial(
+      i, reinterpret_cast<const bn254::Fr&>(*numerator));
 }
 
 void tachyon_bn254_univariate_rational_evaluations_set_rational(
     tachyon_bn254_univariate_rational_evaluations* evals, size_t i,
     const tachyon_bn254_fr* numerator, const tachyon_bn254_fr* denominator) {
   // NOTE(chokobole): Boundary check is the responsibility of API callers.
-  reinterpret_cast<RationalEvals&>(*evals).at(i) = {
-      reinterpret_cast<const bn254::Fr&>(*numerator),
-      reinterpret_cast<const bn254::Fr&>(*denominator),
-  };
+  reinterpret_cast<RationalEvals&>(*evals).SetRational(
+      i, reinterpret_cast<const bn254::Fr&>(*numerator),
+      reinterpret_cast<const bn254::Fr&>(*denominator));
+}
+
+void tachyon_bn254_univariate_rational_evaluations_set_zeros(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t offset,
+    size_t len) {
+  reinterpret_cast<RationalEvals&>(*evals).SetZeros(offset, len);
+}
+
+void tachyon_bn254_univariate_rational_evaluations_set_trivials(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t offset,
+    const tachyon_bn254_fr* numerators, size_t len) {
+  reinterpret_cast<RationalEvals&>(*evals).SetTrivials(
+      offset, ToSpan(numerators, len));
+}
+
+void tachyon_bn254_univariate_rational_evaluations_set_rationals(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t offset,
+    const tachyon_bn254_fr* numerators, const tachyon_bn254_fr* denominators,
+    size_t len) {
+  reinterpret_cast<RationalEvals&>(*evals).SetRationals(
+      offset, ToSpan(numerators, len), ToSpan(denominators, len));
 }
 
 tachyon_bn254_univariate_evaluations*
 tachyon_bn254_univariate_rational_evaluations_batch_evaluate(
     const tachyon_bn254_univariate_rational_evaluations* rational_evals) {
-  const RationalEvals& cpp_rational_eval =
+  const RationalEvals& cpp_rational_evals =
       reinterpret_cast<const RationalEvals&>(*rational_evals);
-  std::vector<bn254::Fr> cpp_values(cpp_rational_eval.NumElements());
-  CHECK(RationalField<bn254::Fr>::BatchEvaluate(cpp_rational_eval.evaluations(),
-                                                &cpp_values));
+  std::vector<bn254::Fr> cpp_values;
+  CHECK(cpp_rational_evals.BatchEvaluate(&cpp_values));
   Evals* cpp_evals = new Evals(Evals(std::move(cpp_values)));
   return reinterpret_cast<tachyon_bn254_univariate_evaluations*>(cpp_evals);
 }
@@ -38,6 +38,24 @@ tachyon_bn254_univariate_rational_evaluations_set_rational(
     tachyon_bn254_univariate_rational_evaluations* evals, size_t i,
     const tachyon_bn254_fr* numerator, const tachyon_bn254_fr* denominator);
 
+// Sets |len| cells from |offset| to zero.
+TACHYON_C_EXPORT void tachyon_bn254_univariate_rational_evaluations_set_zeros(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t offset,
+    size_t len);
+
+// Sets |len| cells from |offset| to |numerators|.
+TACHYON_C_EXPORT void
+tachyon_bn254_univariate_rational_evaluations_set_trivials(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t offset,
+    const tachyon_bn254_fr* numerators, size_t len);
+
+// Sets |len| cells from |offset| to |numerators| / |denominators|.
+TACHYON_C_EXPORT void
+tachyon_bn254_univariate_rational_evaluations_set_rationals(
+    tachyon_bn254_univariate_rational_evaluations* evals, size_t offset,
+    const tachyon_bn254_fr* numerators, const tachyon_bn254_fr* denominators,
+    size_t len);
+
 TACHYON_C_EXPORT tachyon_bn254_univariate_evaluations*
 tachyon_bn254_univariate_rational_evaluations_batch_evaluate(
     const tachyon_bn254_univariate_rational_evaluations* evals);
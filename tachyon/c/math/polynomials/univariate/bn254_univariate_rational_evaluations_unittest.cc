@@ -9,6 +9,7 @@
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr_prime_field_traits.h"
 #include "tachyon/c/math/polynomials/constants.h"
 #include "tachyon/cc/math/finite_fields/prime_field_conversions.h"
+#include "tachyon/math/base/compact_rational_column.h"
 #include "tachyon/math/base/rational_field.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
@@ -23,12 +24,14 @@ constexpr size_t kDegree = 5;
 class UnivariateRationalEvaluationsTest : public FiniteFieldTest<bn254::Fr> {
  public:
   using Evals = UnivariateEvaluations<bn254::Fr, c::math::kMaxDegree>;
-  using RationalEvals =
-      UnivariateEvaluations<RationalField<bn254::Fr>, c::math::kMaxDegree>;
+  using RationalEvals = CompactRationalColumn<bn254::Fr>;
 
   void SetUp() override {
-    RationalEvals* cpp_evals =
-        new RationalEvals(RationalEvals::Random(kDegree));
+    RationalEvals* cpp_evals = new RationalEvals(kDegree + 1);
+    for (size_t i = 0; i < kDegree + 1; ++i) {
+      RationalField<bn254::Fr> value = RationalField<bn254::Fr>::Random();
+      cpp_evals->SetRational(i, value.numerator(), value.denominator());
+    }
     evals_ = reinterpret_cast<tachyon_bn254_univariate_rational_evaluations*>(
         cpp_evals);
   }
@@ -47,8 +50,8 @@ TEST_F(UnivariateRationalEvaluationsTest, Clone) {
   tachyon_bn254_univariate_rational_evaluations* evals_clone =
       tachyon_bn254_univariate_rational_evaluations_clone(evals_);
   // NOTE(chokobole): It's safe to access since we created |kDegree| |evals_|.
-  reinterpret_cast<RationalEvals&>(*evals_).at(0) +=
-      RationalField<bn254::Fr>::One();
+  reinterpret_cast<RationalEvals&>(*evals_).SetTrivial(0,
+                                                      bn254::Fr::Random());
   EXPECT_NE((reinterpret_cast<RationalEvals&>(*evals_))[0],
             (reinterpret_cast<RationalEvals&>(*evals_clone))[0]);
   tachyon_bn254_univariate_rational_evaluations_destroy(evals_clone);
@@ -102,4 +105,31 @@ TEST_F(UnivariateRationalEvaluationsTest, BatchEvaluate) {
   EXPECT_EQ(reinterpret_cast<Evals&>(*evaluated).evaluations(), values);
 }
 
+TEST_F(UnivariateRationalEvaluationsTest, BulkSetters) {
+  std::vector<bn254::Fr> numerators =
+      base::CreateVector(3, []() { return bn254::Fr::Random(); });
+  std::vector<bn254::Fr> denominators =
+      base::CreateVector(3, []() { return bn254::Fr::Random(); });
+
+  tachyon_bn254_univariate_rational_evaluations_set_zeros(evals_, 0, 2);
+  tachyon_bn254_univariate_rational_evaluations_set_trivials(
+      evals_, 2, reinterpret_cast<const tachyon_bn254_fr*>(numerators.data()),
+      2);
+  tachyon_bn254_univariate_rational_evaluations_set_rationals(
+      evals_, 3,
+      reinterpret_cast<const tachyon_bn254_fr*>(numerators.data()),
+      reinterpret_cast<const tachyon_bn254_fr*>(denominators.data()), 3);
+
+  const RationalEvals& cpp_evals = reinterpret_cast<RationalEvals&>(*evals_);
+  EXPECT_TRUE(cpp_evals[0].IsZero());
+  EXPECT_TRUE(cpp_evals[1].IsZero());
+  EXPECT_EQ(cpp_evals[2], RationalField<bn254::Fr>(numerators[0]));
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(cpp_evals[3 + i],
+              RationalField<bn254::Fr>(numerators[i], denominators[i]));
+  }
+  // Only the cells set by |set_rationals()| keep their denominators.
+  EXPECT_EQ(cpp_evals.num_rationals(), size_t{3});
+}
+
 }  // namespace tachyon::math
@@ -12,6 +12,7 @@
 #include "tachyon/c/zk/plonk/keys/proving_key_impl_base.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 #include "tachyon/zk/plonk/halo2/blake2b_transcript.h"
+#include "tachyon/zk/plonk/halo2/params_reader.h"
 #include "tachyon/zk/plonk/halo2/prover.h"
 
 using namespace tachyon;
@@ -93,6 +94,47 @@ tachyon_halo2_bn254_shplonk_prover_create_from_params(uint8_t transcript_type,
   return reinterpret_cast<tachyon_halo2_bn254_shplonk_prover*>(prover);
 }
 
+tachyon_halo2_bn254_shplonk_prover*
+tachyon_halo2_bn254_shplonk_prover_create_from_params_file(
+    uint8_t transcript_type, uint32_t k, const char* params_path) {
+  math::bn254::BN254Curve::Init();
+
+  ProverImpl* prover = new ProverImpl(
+      [transcript_type, k, params_path]() {
+        crypto::KZG<math::bn254::G1AffinePoint, c::math::kMaxDegree,
+                    math::bn254::G1AffinePoint>
+            kzg;
+        math::bn254::G2AffinePoint s_g2;
+        zk::plonk::halo2::ParamsReader<math::bn254::BN254Curve> reader;
+        // NOTE: The cofactor of bn254 G1 is 1.
+        reader.set_check_g1_subgroup(false);
+        CHECK(reader.ReadFromFile(base::FilePath(params_path), k, &kzg, &s_g2));
+        PCS pcs(crypto::SHPlonk<math::bn254::BN254Curve, c::math::kMaxDegree,
+                                math::bn254::G1AffinePoint>(std::move(kzg),
+                                                            std::move(s_g2)));
+
+        base::Uint8VectorBuffer write_buf;
+        std::unique_ptr<crypto::TranscriptWriter<math::bn254::G1AffinePoint>>
+            writer;
+        if (transcript_type == TACHYON_HALO2_BLAKE_TRANSCRIPT) {
+          writer = std::make_unique<
+              zk::plonk::halo2::Blake2bWriter<math::bn254::G1AffinePoint>>(
+              std::move(write_buf));
+        } else {
+          NOTREACHED();
+        }
+        zk::plonk::halo2::Prover<PCS> prover =
+            zk::plonk::halo2::Prover<PCS>::CreateFromRNG(
+                std::move(pcs), std::move(writer),
+                /*rng=*/nullptr,
+                /*blinding_factors=*/0);
+        prover.set_domain(PCS::Domain::Create(size_t{1} << k));
+        return prover;
+      },
+      transcript_type);
+  return reinterpret_cast<tachyon_halo2_bn254_shplonk_prover*>(prover);
+}
+
 void tachyon_halo2_bn254_shplonk_prover_destroy(
     tachyon_halo2_bn254_shplonk_prover* prover) {
   delete reinterpret_cast<ProverImpl*>(prover);
@@ -28,6 +28,14 @@ tachyon_halo2_bn254_shplonk_prover_create_from_params(uint8_t transcript_type,
                                                       const uint8_t* params,
                                                       size_t params_len);
 
+// Creates a prover from the params file of |params_path| written by
+// |ParamsKZG::write()| of halo2. The file is mapped and its points are
+// decompressed in parallel. If |k| is less than the one of the file, the
+// params are downsized.
+TACHYON_C_EXPORT tachyon_halo2_bn254_shplonk_prover*
+tachyon_halo2_bn254_shplonk_prover_create_from_params_file(
+    uint8_t transcript_type, uint32_t k, const char* params_path);
+
 TACHYON_C_EXPORT void tachyon_halo2_bn254_shplonk_prover_destroy(
     tachyon_halo2_bn254_shplonk_prover* prover);
 
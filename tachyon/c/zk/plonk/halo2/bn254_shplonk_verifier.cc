@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_shplonk_verifier_impl.h"
 #include "tachyon/c/zk/plonk/halo2/bn254_transcript.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
@@ -17,6 +18,22 @@ using Verifier = c::zk::plonk::halo2::bn254::SHPlonkVerifierImpl;
 using VKey =
     zk::plonk::VerifyingKey<math::bn254::Fr, math::bn254::G1AffinePoint>;
 
+namespace {
+
+std::unique_ptr<crypto::TranscriptReader<math::bn254::G1AffinePoint>>
+CreateReader(uint8_t transcript_type, const uint8_t* proof, size_t proof_len) {
+  base::ReadOnlyBuffer read_buf(proof, proof_len);
+  if (transcript_type == TACHYON_HALO2_BLAKE_TRANSCRIPT) {
+    return std::make_unique<
+        zk::plonk::halo2::Blake2bReader<math::bn254::G1AffinePoint>>(
+        std::move(read_buf));
+  }
+  NOTREACHED();
+  return nullptr;
+}
+
+}  // namespace
+
 tachyon_halo2_bn254_shplonk_verifier*
 tachyon_halo2_bn254_shplonk_verifier_create_from_params(
     uint8_t transcript_type, uint32_t k, const uint8_t* params,
@@ -29,18 +46,8 @@ tachyon_halo2_bn254_shplonk_verifier_create_from_params(
         base::ReadOnlyBuffer read_buf(params, params_len);
         CHECK(read_buf.Read(&pcs));
 
-        read_buf = base::ReadOnlyBuffer(proof, proof_len);
-        std::unique_ptr<crypto::TranscriptReader<math::bn254::G1AffinePoint>>
-            reader;
-        if (transcript_type == TACHYON_HALO2_BLAKE_TRANSCRIPT) {
-          reader = std::make_unique<
-              zk::plonk::halo2::Blake2bReader<math::bn254::G1AffinePoint>>(
-              std::move(read_buf));
-        } else {
-          NOTREACHED();
-        }
-        zk::plonk::halo2::Verifier<PCS> verifier(std::move(pcs),
-                                                 std::move(reader));
+        zk::plonk::halo2::Verifier<PCS> verifier(
+            std::move(pcs), CreateReader(transcript_type, proof, proof_len));
         verifier.set_domain(PCS::Domain::Create(size_t{1} << k));
         return verifier;
       },
@@ -63,3 +70,34 @@ bool tachyon_halo2_bn254_shplonk_verifier_verify_proof(
   tachyon_halo2_bn254_instance_columns_vec_destroy(instance_columns_vec);
   return ret;
 }
+
+bool tachyon_halo2_bn254_shplonk_verifier_batch_verify_proofs(
+    tachyon_halo2_bn254_shplonk_verifier* verifier,
+    const tachyon_bn254_plonk_verifying_key* vkey, const uint8_t** proofs,
+    const size_t* proof_lens,
+    tachyon_halo2_bn254_instance_columns_vec** instance_columns_vecs,
+    size_t num_proofs) {
+  using InstanceColumnsVec =
+      std::vector<std::vector<std::vector<math::bn254::Fr>>>;
+
+  Verifier* cpp_verifier = reinterpret_cast<Verifier*>(verifier);
+  std::vector<
+      std::unique_ptr<crypto::TranscriptReader<math::bn254::G1AffinePoint>>>
+      readers = base::CreateVector(
+          num_proofs, [cpp_verifier, proofs, proof_lens](size_t i) {
+            return CreateReader(cpp_verifier->transcript_type(), proofs[i],
+                                proof_lens[i]);
+          });
+  std::vector<InstanceColumnsVec> cpp_instance_columns_vecs =
+      base::CreateVector(num_proofs, [instance_columns_vecs](size_t i) {
+        return std::move(
+            reinterpret_cast<InstanceColumnsVec&>(*instance_columns_vecs[i]));
+      });
+  bool ret = cpp_verifier->BatchVerifyProofs(
+      reinterpret_cast<const VKey&>(*vkey), std::move(readers),
+      cpp_instance_columns_vecs);
+  for (size_t i = 0; i < num_proofs; ++i) {
+    tachyon_halo2_bn254_instance_columns_vec_destroy(instance_columns_vecs[i]);
+  }
+  return ret;
+}
@@ -28,6 +28,20 @@ TACHYON_C_EXPORT bool tachyon_halo2_bn254_shplonk_verifier_verify_proof(
     const tachyon_bn254_plonk_verifying_key* vkey,
     tachyon_halo2_bn254_instance_columns_vec* instance_columns_vec);
 
+// Verifies |num_proofs| proofs that are created with the same |vkey| at once.
+// |proofs[i]| and |proof_lens[i]| are the i-th proof and its length and
+// |instance_columns_vecs[i]| is its instance columns. The final pairing checks
+// of all the proofs are combined with random scalars and checked with a single
+// multi pairing, so this returns false if any of the proofs is invalid without
+// telling which one.
+// Note that |instance_columns_vecs| are destroyed after this call.
+TACHYON_C_EXPORT bool tachyon_halo2_bn254_shplonk_verifier_batch_verify_proofs(
+    tachyon_halo2_bn254_shplonk_verifier* verifier,
+    const tachyon_bn254_plonk_verifying_key* vkey, const uint8_t** proofs,
+    const size_t* proof_lens,
+    tachyon_halo2_bn254_instance_columns_vec** instance_columns_vecs,
+    size_t num_proofs);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
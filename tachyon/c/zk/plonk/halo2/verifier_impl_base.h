@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -40,6 +41,38 @@ class VerifierImplBase : public tachyon::zk::plonk::halo2::Verifier<PCS> {
     return Base::VerifyProof(vkey, cpp_instance_columns_vec);
   }
 
+  // Verifies the proofs read by |readers| against |vkey| at once. See
+  // |tachyon::zk::plonk::halo2::Verifier::BatchVerifyProofs()|.
+  [[nodiscard]] bool BatchVerifyProofs(
+      const tachyon::zk::plonk::VerifyingKey<F, Commitment>& vkey,
+      std::vector<std::unique_ptr<
+          tachyon::crypto::TranscriptReader<Commitment>>>&&
+          readers,
+      std::vector<std::vector<std::vector<std::vector<F>>>>&
+          instance_columns_vecs) {
+    std::vector<tachyon::crypto::TranscriptReader<Commitment>*> reader_ptrs =
+        base::Map(readers,
+                  [](std::unique_ptr<
+                      tachyon::crypto::TranscriptReader<Commitment>>& reader) {
+                    return reader.get();
+                  });
+    std::vector<std::vector<std::vector<Evals>>> cpp_instance_columns_vecs =
+        base::Map(
+            instance_columns_vecs,
+            [](std::vector<std::vector<std::vector<F>>>& instance_columns_vec) {
+              return base::Map(
+                  instance_columns_vec,
+                  [](std::vector<std::vector<F>>& instance_columns) {
+                    return base::Map(instance_columns,
+                                     [](std::vector<F>& instance_column) {
+                                       return Evals(std::move(instance_column));
+                                     });
+                  });
+            });
+    return Base::BatchVerifyProofs(vkey, reader_ptrs,
+                                   cpp_instance_columns_vecs);
+  }
+
  protected:
   uint8_t transcript_type_;
 };
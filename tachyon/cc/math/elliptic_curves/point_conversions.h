@@ -160,6 +160,19 @@ void ToCPoint3(const Point& point_in, CPoint* point_out) {
          sizeof(uint64_t) * LimbNumbs);
 }
 
+// NOTE: This is for points over an extension field, e.g., G2. A C extension
+// field has the same layout as its |BaseField|, a sequence of its
+// coefficients in montgomery form.
+template <typename Point, typename CPoint,
+          typename BaseField = typename Point::BaseField,
+          std::enable_if_t<(BaseField::ExtensionDegree() > 1)>* = nullptr>
+void ToCPoint3(const Point& point_in, CPoint* point_out) {
+  static_assert(sizeof(point_out->x) == sizeof(BaseField));
+  memcpy(&point_out->x, &point_in.x(), sizeof(BaseField));
+  memcpy(&point_out->y, &point_in.y(), sizeof(BaseField));
+  memcpy(&point_out->z, &point_in.z(), sizeof(BaseField));
+}
+
 template <typename Point, typename CPoint,
           typename BaseField = typename Point::BaseField,
           size_t LimbNumbs = BaseField::kLimbNums>
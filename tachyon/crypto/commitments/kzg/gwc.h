@@ -14,6 +14,7 @@
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/crypto/commitments/kzg/kzg_family.h"
+#include "tachyon/crypto/commitments/kzg/kzg_pairing_accumulator.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
@@ -49,6 +50,7 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
   using Poly = typename Base::Poly;
   using Point = typename Poly::Point;
   using PointDeepRef = base::DeepRef<const Point>;
+  using PairingAccumulator = KZGPairingAccumulator<Curve>;
 
   GWC() = default;
   explicit GWC(KZG<G1Point, MaxDegree, Commitment>&& kzg)
@@ -70,6 +72,12 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
     return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
   }
 
+  // Checks all the pairing checks deferred to |accumulator| at once.
+  [[nodiscard]] bool VerifyPairingAccumulator(
+      const PairingAccumulator& accumulator) const {
+    return accumulator.Verify(g2_arr_);
+  }
+
  private:
   friend class VectorCommitmentScheme<GWC<Curve, MaxDegree, Commitment>>;
   friend class UnivariatePolynomialCommitmentScheme<
@@ -108,9 +116,9 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
       // W₃(X) = H₃(X) / (X - x₃) = (P₃(X) - P₃(x₃)) / (X - x₃)
       // W₄(X) = H₄(X) / (X - x₄) = (P₄(X) - P₄(x₄)) / (X - x₄)
       // clang-format on
-      std::vector<Poly> low_degree_extensions;
-      Poly w = grouped_poly_openings_vec[i].CreateCombinedLowDegreeExtensions(
-          v, low_degree_extensions);
+      // NOTE: Wᵢ(X) doesn't depend on the openings, since they only shift
+      // the remainder of the division by (X - xᵢ).
+      Poly w = grouped_poly_openings_vec[i].CreateCombinedQuotient(v);
       if (!this->Commit(w, i)) return false;
     }
 
@@ -126,6 +134,29 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
   [[nodiscard]] bool DoVerifyOpeningProof(
       const Container& poly_openings,
       TranscriptReader<Commitment>* reader) const {
+    std::array<G1Point, 2> g1_arr;
+    if (!ComputePairingInputs(poly_openings, reader, &g1_arr)) return false;
+    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+  }
+
+  // Same as above, but the final pairing check is deferred to |accumulator|.
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      PairingAccumulator* accumulator) const {
+    std::array<G1Point, 2> g1_arr;
+    if (!ComputePairingInputs(poly_openings, reader, &g1_arr)) return false;
+    accumulator->Add(g1_arr[0], g1_arr[1]);
+    return true;
+  }
+
+  // Reads the opening proof from |reader| and populates |g1_arr| with the G1
+  // points that need to satisfy e(|g1_arr[0]|, [𝜏]₂) * e(|g1_arr[1]|, [-1]₂)
+  // ≟ gᴛ⁰.
+  template <typename Container>
+  [[nodiscard]] bool ComputePairingInputs(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      std::array<G1Point, 2>* g1_arr) const {
     using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
 
     Field v = reader->SqueezeChallenge();
@@ -224,10 +255,7 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
     G1JacobianPoint g1_jacobian_arr[] = {
         witness, (witness_with_aux + commitment_multi -
                   opening_multi * G1JacobianPoint::Generator())};
-    G1Point g1_arr[2];
-    if (!G1JacobianPoint::BatchNormalize(g1_jacobian_arr, &g1_arr))
-      return false;
-    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+    return G1JacobianPoint::BatchNormalize(g1_jacobian_arr, g1_arr);
   }
 
   // KZGFamily methods
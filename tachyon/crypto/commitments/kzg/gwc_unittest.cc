@@ -14,6 +14,8 @@ class GWCTest : public KZGFamilyTest<PCS> {};
 
 TEST_F(GWCTest, CreateAndVerifyProof) { this->CreateAndVerifyProof(); }
 
+TEST_F(GWCTest, BatchVerifyProofs) { this->BatchVerifyProofs(); }
+
 TEST_F(GWCTest, Copyable) { this->Copyable(); }
 
 }  // namespace tachyon::crypto
@@ -11,14 +11,27 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/strings/str_replace.h"
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/crypto/random/xor_shift/xor_shift_rng.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/polynomials/univariate/ec_fft.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 
 namespace tachyon {
@@ -33,6 +46,21 @@ class KZG {
 
   static constexpr size_t kMaxDegree = MaxDegree;
 
+  // |UnsafeSetup()| maps the scalars to points by chunks of this size, each
+  // of which is normalized on its own, so that its temporaries don't grow
+  // with the size of SRS.
+  constexpr static size_t kSetupChunkSize = size_t{1} << 10;
+  // The maximum window bits of the fixed-base window table of g₁ used by
+  // |UnsafeSetup()|.
+  constexpr static unsigned int kSetupMaxWindowBits = 12;
+
+  enum class LagrangeSetupMethod {
+    // Evaluates the Lagrange basis at 𝜏 and maps them to points.
+    kFromTau,
+    // Applies |DeriveLagrangeFromMonomial()|.
+    kFromMonomial,
+  };
+
   KZG() = default;
 
   KZG(std::vector<G1Point>&& g1_powers_of_tau,
@@ -72,30 +100,148 @@ class KZG {
     return UnsafeSetup(size, Field::Random());
   }
 
-  [[nodiscard]] bool UnsafeSetup(size_t size, const Field& tau) {
-    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+  [[nodiscard]] bool UnsafeSetup(
+      size_t size, const Field& tau,
+      LagrangeSetupMethod method = LagrangeSetupMethod::kFromTau) {
     using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
-    // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
-    G1Point g1 = G1Point::Generator();
-    std::vector<Field> powers_of_tau = Field::GetSuccessivePowers(size, tau);
-    std::vector<G1JacobianPoint> g1_powers_of_tau_jacobian;
+    // The window table of g₁ is shared by every chunk below.
+    math::FixedBaseMSM<G1Point> msm;
+    msm.Reset(size,
+              std::min(math::MSMCtx::ComputeWindowsBits(size),
+                       kSetupMaxWindowBits),
+              G1Point::Generator());
 
+    // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
     g1_powers_of_tau_.resize(size);
-    if (!G1Point::BatchMapScalarFieldToPoint(g1, powers_of_tau,
-                                             &g1_powers_of_tau_)) {
-      return false;
+    BatchMapToPoints(msm,
+                     [&tau](size_t from, absl::Span<Field> scalars) {
+                       Field power = tau.Pow(from);
+                       for (Field& scalar : scalars) {
+                         scalar = power;
+                         power *= tau;
+                       }
+                     },
+                     g1_powers_of_tau_);
+
+    if (method == LagrangeSetupMethod::kFromMonomial) {
+      return DeriveLagrangeFromMonomial();
     }
 
-    // Get |g1_powers_of_tau_lagrange_| from 𝜏 and g₁.
+    // Get |g1_powers_of_tau_lagrange_| from 𝜏 and g₁, where
+    // Lᵢ(𝜏) = Z_H(𝜏) * ωⁱ / (n * (𝜏 - ωⁱ)).
     std::unique_ptr<Domain> domain = Domain::Create(size);
-    std::vector<Field> lagrange_coeffs =
-        domain->EvaluateAllLagrangeCoefficients(tau);
-    std::vector<G1JacobianPoint> g1_powers_of_tau_lagrange_jacobian;
+    Field vanishing = domain->EvaluateVanishingPolynomial(tau);
+    Field scale = vanishing * domain->size_inv();
+    g1_powers_of_tau_lagrange_.resize(size);
+    BatchMapToPoints(
+        msm,
+        [&tau, &domain, &vanishing, &scale](size_t from,
+                                            absl::Span<Field> scalars) {
+          const Field& group_gen = domain->group_gen();
+          Field omega_i = domain->GetElement(from);
+          if (vanishing.IsZero()) {
+            // NOTE: 𝜏 is one of ωⁱ, so Lᵢ(𝜏) is 1 for that i and 0 for the
+            // others.
+            for (Field& scalar : scalars) {
+              scalar = omega_i == tau ? Field::One() : Field::Zero();
+              omega_i *= group_gen;
+            }
+            return;
+          }
+          for (Field& scalar : scalars) {
+            scalar = tau - omega_i;
+            omega_i *= group_gen;
+          }
+          CHECK(Field::BatchInverseInPlaceSerial(scalars));
+          omega_i = domain->GetElement(from);
+          for (Field& scalar : scalars) {
+            scalar *= scale * omega_i;
+            omega_i *= group_gen;
+          }
+        },
+        g1_powers_of_tau_lagrange_);
+    return true;
+  }
+
+  // Same as |UnsafeSetup()|, but 𝜏 is derived from |seed| and the SRS is
+  // cached in |cache_dir|. If it was generated for the same curve, size and
+  // |seed| before, it is read from there instead. This is meant for
+  // development and tests, which run the same setup over and over.
+  [[nodiscard]] bool UnsafeSetupWithCache(size_t size, uint64_t seed,
+                                          const base::FilePath& cache_dir) {
+    std::string cache_name = GetCacheName(size, seed);
+    base::FilePath cache_path = cache_dir.Append(cache_name);
+    std::optional<std::vector<uint8_t>> bytes =
+        base::ReadFileToBytes(cache_path);
+    if (bytes.has_value()) {
+      base::ReadOnlyBuffer buffer(bytes->data(), bytes->size());
+      KZG kzg;
+      if (buffer.Read(&kzg) && buffer.Done() && kzg.N() == size) {
+        *this = std::move(kzg);
+        return true;
+      }
+      LOG(WARNING) << "Ignoring the broken SRS cache: " << cache_path.value();
+    }
+
+    if (!UnsafeSetup(size, GetTauFromSeed(seed))) return false;
+
+    base::Uint8VectorBuffer buffer;
+    base::FilePath temp_path = cache_dir.Append(cache_name + ".tmp");
+    if (!base::CreateDirectory(cache_dir) ||
+        !buffer.Grow(base::EstimateSize(*this)) || !buffer.Write(*this) ||
+        !base::WriteLargeFile(temp_path,
+                              absl::MakeConstSpan(buffer.owned_buffer())) ||
+        !base::ReplaceFile(temp_path, cache_path, nullptr)) {
+      // NOTE: The setup itself succeeded, so a failure to cache it isn't an
+      // error.
+      LOG(WARNING) << "Failed to write the SRS cache: " << cache_path.value();
+    }
+    return true;
+  }
+
+  // Returns the name of the file in which |UnsafeSetupWithCache()| caches the
+  // SRS of |size| for |seed|.
+  static std::string GetCacheName(size_t size, uint64_t seed) {
+    return absl::Substitute(
+        "$0_n$1_seed$2.srs",
+        absl::StrReplaceAll(G1Point::BaseField::Config::kName, {{"::", "_"}}),
+        size, seed);
+  }
+
+  // Returns 𝜏 used by |UnsafeSetupWithCache()| for |seed|.
+  static Field GetTauFromSeed(uint64_t seed) {
+    XORShiftRNG rng = XORShiftRNG::FromState(
+        static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+        195911405, 195911405);
+    math::BigInt<Field::kLimbNums * 2> big_int;
+    for (size_t i = 0; i < Field::kLimbNums * 2; ++i) {
+      big_int[i] = rng.NextUint64();
+    }
+    return Field::FromAnySizedBigInt(big_int);
+  }
+
+  // Populates |g1_powers_of_tau_lagrange_| from |g1_powers_of_tau_| by an
+  // IFFT over G1. Unlike |UnsafeSetup()|, this doesn't need 𝜏, so it works
+  // for the monomial bases loaded from a ceremony, but it only supports
+  // sizes of a power of two.
+  [[nodiscard]] bool DeriveLagrangeFromMonomial() {
+    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+    using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
+    size_t size = g1_powers_of_tau_.size();
+    if (!base::bits::IsPowerOfTwo(size)) {
+      LOG(ERROR) << "The size of SRS is not a power of two: " << size;
+      return false;
+    }
+    std::unique_ptr<Domain> domain = Domain::Create(size);
+    std::vector<G1JacobianPoint> points = base::Map(
+        g1_powers_of_tau_,
+        [](const G1Point& point) { return point.ToJacobian(); });
+    if (!math::ECIFFTInPlace(*domain, &points)) return false;
     g1_powers_of_tau_lagrange_.resize(size);
-    return G1Point::BatchMapScalarFieldToPoint(g1, lagrange_coeffs,
-                                               &g1_powers_of_tau_lagrange_);
+    return G1JacobianPoint::BatchNormalize(points,
+                                           &g1_powers_of_tau_lagrange_);
   }
 
   // Return false if |n| >= |N()|.
@@ -129,7 +275,85 @@ class KZG {
     return DoMSM(g1_powers_of_tau_lagrange_, v, state, index);
   }
 
+  // Commits to every vector of |vs| and stores the commitments in
+  // |batch_commitments_| from |index|. The vectors are committed with a
+  // single multi-MSM, which reads the Lagrange bases once for all of them.
+  // If the vectors have different sizes, they are committed one by one.
+  [[nodiscard]] bool CommitLagrangeMulti(
+      absl::Span<const absl::Span<const Field>> vs, BatchCommitmentState& state,
+      size_t index) {
+    if (index + vs.size() > batch_commitments_.size()) {
+      LOG(ERROR) << "Too many vectors to commit: " << vs.size();
+      return false;
+    }
+    if (vs.empty()) return true;
+    size_t size = vs[0].size();
+    if (std::any_of(vs.begin(), vs.end(),
+                    [size](absl::Span<const Field> v) {
+                      return v.size() != size;
+                    })) {
+      for (size_t i = 0; i < vs.size(); ++i) {
+        if (!DoMSM(g1_powers_of_tau_lagrange_, vs[i], state, index + i)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    math::VariableBaseMSM<G1Point> msm;
+    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
+        g1_powers_of_tau_lagrange_.data(),
+        std::min(g1_powers_of_tau_lagrange_.size(), size));
+    return msm.RunMulti(bases_span, vs,
+                        absl::MakeSpan(batch_commitments_)
+                            .subspan(index, vs.size()));
+  }
+
+  // Same as |CommitLagrange()|, but the MSM only runs over the nonzero
+  // elements of |v| and their Lagrange bases. The elements beyond |v.size()|
+  // are regarded as zero. This suits |v| with a few nonzero elements, such
+  // as instance columns. Returns false if |v| is longer than |N()|.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool CommitLagrangeSparse(const ScalarContainer& v,
+                                          Commitment* out) const {
+    if (std::size(v) > N()) {
+      LOG(ERROR) << "Too many elements to commit: " << std::size(v);
+      return false;
+    }
+    std::vector<G1Point> bases;
+    std::vector<Field> scalars;
+    for (size_t i = 0; i < std::size(v); ++i) {
+      if (v[i].IsZero()) continue;
+      bases.push_back(g1_powers_of_tau_lagrange_[i]);
+      scalars.push_back(v[i]);
+    }
+    return DoMSM(bases, scalars, out);
+  }
+
  private:
+  // Maps scalars to points with |msm| by chunks of |kSetupChunkSize| in
+  // parallel. |fill_scalars| fills the scalars of a chunk given the index of
+  // its first element.
+  template <typename Callable>
+  static void BatchMapToPoints(const math::FixedBaseMSM<G1Point>& msm,
+                               Callable fill_scalars,
+                               std::vector<G1Point>& points) {
+    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+
+    base::ParallelizeByChunkSize(
+        points, kSetupChunkSize,
+        [&msm, &fill_scalars](absl::Span<G1Point> chunk, size_t chunk_index,
+                              size_t chunk_size) {
+          std::vector<Field> scalars(chunk.size());
+          fill_scalars(chunk_index * chunk_size, absl::MakeSpan(scalars));
+          std::vector<G1JacobianPoint> jacobian_points = base::Map(
+              scalars, [&msm](const Field& scalar) {
+                return msm.ScalarMul(scalar);
+              });
+          CHECK(G1JacobianPoint::BatchNormalizeSerial(jacobian_points,
+                                                      &chunk));
+        });
+  }
+
   template <typename BaseContainer, typename ScalarContainer>
   static bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
                     Commitment* out) {
@@ -10,7 +10,11 @@
 #include <stddef.h>
 
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -38,6 +42,14 @@ class KZGFamily {
     return kzg_.UnsafeSetup(size, tau) && DoUnsafeSetupWithTau(size, tau);
   }
 
+  // See |KZG::UnsafeSetupWithCache()|.
+  [[nodiscard]] bool UnsafeSetupWithCache(size_t size, uint64_t seed,
+                                          const base::FilePath& cache_dir) {
+    return kzg_.UnsafeSetupWithCache(size, seed, cache_dir) &&
+           DoUnsafeSetupWithTau(
+               size, KZG<G1Point, MaxDegree, Commitment>::GetTauFromSeed(seed));
+  }
+
   template <typename ScalarContainer>
   [[nodiscard]] bool DoCommit(const ScalarContainer& poly,
                               Commitment* commitment) const {
@@ -87,6 +99,24 @@ class KZGFamily {
     return kzg_.CommitLagrange(evals.evaluations(), state, index);
   }
 
+  [[nodiscard]] bool DoCommitLagrangeMulti(
+      absl::Span<const math::UnivariateEvaluations<F, MaxDegree>* const>
+          evals_list,
+      BatchCommitmentState& state, size_t index) {
+    std::vector<absl::Span<const F>> vs = base::Map(
+        evals_list,
+        [](const math::UnivariateEvaluations<F, MaxDegree>* evals) {
+          return absl::MakeConstSpan(evals->evaluations());
+        });
+    return kzg_.CommitLagrangeMulti(vs, state, index);
+  }
+
+  [[nodiscard]] bool DoCommitLagrangeSparse(
+      const math::UnivariateEvaluations<F, MaxDegree>& evals,
+      Commitment* commitment) const {
+    return kzg_.CommitLagrangeSparse(evals.evaluations(), commitment);
+  }
+
  protected:
   [[nodiscard]] virtual bool DoUnsafeSetupWithTau(size_t size,
                                                   const F& tau) = 0;
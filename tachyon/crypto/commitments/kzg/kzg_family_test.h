@@ -60,6 +60,42 @@ class KZGFamilyTest : public testing::Test {
     EXPECT_TRUE((pcs_.VerifyOpeningProof(verifier_openings, &reader)));
   }
 
+  void BatchVerifyProofs() {
+    constexpr size_t kNumProofs = 3;
+
+    OwnedPolynomialOpenings<Poly, Commitment> owned_openings;
+    std::string error;
+    ASSERT_TRUE(
+        LoadAndParseJson(base::FilePath("tachyon/crypto/commitments/test/"
+                                        "bn254_kzg_polynomial_openings.json"),
+                         &owned_openings, &error));
+    ASSERT_TRUE(error.empty());
+
+    std::vector<PolynomialOpening<Poly>> prover_openings =
+        owned_openings.CreateProverOpenings();
+    std::vector<PolynomialOpening<Poly, Commitment>> verifier_openings =
+        owned_openings.CreateVerifierOpenings();
+
+    typename PCS::PairingAccumulator accumulator;
+    for (size_t i = 0; i < kNumProofs; ++i) {
+      SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+      ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings, &writer));
+
+      base::Buffer read_buf(writer.buffer().buffer(),
+                            writer.buffer().buffer_len());
+      SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+      ASSERT_TRUE(
+          pcs_.VerifyOpeningProof(verifier_openings, &reader, &accumulator));
+    }
+    ASSERT_EQ(accumulator.size(), kNumProofs);
+    EXPECT_TRUE(pcs_.VerifyPairingAccumulator(accumulator));
+
+    // A single invalid check makes the whole batch invalid.
+    accumulator.Add(math::bn254::G1AffinePoint::Generator(),
+                    math::bn254::G1AffinePoint::Generator());
+    EXPECT_FALSE(pcs_.VerifyPairingAccumulator(accumulator));
+  }
+
   void Copyable() {
     std::vector<uint8_t> vec;
     vec.resize(base::EstimateSize(pcs_));
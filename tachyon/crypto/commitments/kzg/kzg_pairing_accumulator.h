@@ -0,0 +1,100 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_PAIRING_ACCUMULATOR_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_PAIRING_ACCUMULATOR_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <vector>
+
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+
+namespace tachyon::crypto {
+
+// |KZGPairingAccumulator| collects the final pairing checks of KZG family
+// opening proofs. Every opening proof verified against the same parameters
+// ends with a check of the form
+//
+//   e(Aᵢ, G₂[0]) * e(Bᵢ, G₂[1]) ≟ gᴛ⁰
+//
+// where G₂ is fixed by the parameters. Instead of running N multi miller loops
+// and N final exponentiations, the checks are combined with random scalars
+// rᵢ into
+//
+//   e(Σᵢ rᵢ * Aᵢ, G₂[0]) * e(Σᵢ rᵢ * Bᵢ, G₂[1]) ≟ gᴛ⁰
+//
+// so that the whole batch costs 2 MSMs, a single multi miller loop over 2 pairs
+// and a single final exponentiation. If any of the checks doesn't hold, the
+// combined one holds with probability at most 1 / |F|.
+template <typename Curve>
+class KZGPairingAccumulator {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using F = typename G1Point::ScalarField;
+  using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  KZGPairingAccumulator() = default;
+
+  const std::vector<G1Point>& lhs() const { return lhs_; }
+  const std::vector<G1Point>& rhs() const { return rhs_; }
+
+  size_t size() const { return lhs_.size(); }
+  bool empty() const { return lhs_.empty(); }
+
+  void Reserve(size_t size) {
+    lhs_.reserve(size);
+    rhs_.reserve(size);
+  }
+
+  // Adds a check e(|lhs|, G₂[0]) * e(|rhs|, G₂[1]) ≟ gᴛ⁰.
+  void Add(const G1Point& lhs, const G1Point& rhs) {
+    lhs_.push_back(lhs);
+    rhs_.push_back(rhs);
+  }
+
+  // Adds the checks accumulated in |other|.
+  void Merge(const KZGPairingAccumulator& other) {
+    lhs_.insert(lhs_.end(), other.lhs_.begin(), other.lhs_.end());
+    rhs_.insert(rhs_.end(), other.rhs_.begin(), other.rhs_.end());
+  }
+
+  void Clear() {
+    lhs_.clear();
+    rhs_.clear();
+  }
+
+  // Returns true if all the accumulated checks hold against |g2_arr|.
+  [[nodiscard]] bool Verify(const std::array<G2Prepared, 2>& g2_arr) const {
+    if (lhs_.empty()) return true;
+    if (lhs_.size() == 1) {
+      std::array<G1Point, 2> g1_arr = {lhs_[0], rhs_[0]};
+      return math::Pairing<Curve>(g1_arr, g2_arr).IsOne();
+    }
+
+    // NOTE: r₀ is fixed to 1. This saves a scalar multiplication
+    // per side and is still sound since the rest of rᵢ are random.
+    std::vector<F> scalars(lhs_.size());
+    scalars[0] = F::One();
+    for (size_t i = 1; i < scalars.size(); ++i) {
+      scalars[i] = F::Random();
+    }
+
+    math::VariableBaseMSM<G1Point> msm;
+    Bucket buckets[2];
+    if (!msm.Run(lhs_, scalars, &buckets[0])) return false;
+    if (!msm.Run(rhs_, scalars, &buckets[1])) return false;
+
+    std::array<G1Point, 2> g1_arr;
+    if (!Bucket::BatchNormalize(buckets, &g1_arr)) return false;
+    return math::Pairing<Curve>(g1_arr, g2_arr).IsOne();
+  }
+
+ private:
+  std::vector<G1Point> lhs_;
+  std::vector<G1Point> rhs_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_PAIRING_ACCUMULATOR_H_
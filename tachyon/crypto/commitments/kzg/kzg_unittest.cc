@@ -1,8 +1,13 @@
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 
+#include <string_view>
+
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 
@@ -36,6 +41,100 @@ TEST_F(KZGTest, UnsafeSetup) {
   EXPECT_EQ(pcs.g1_powers_of_tau_lagrange().size(), size_t{N});
 }
 
+TEST_F(KZGTest, UnsafeSetupAcrossChunks) {
+  using F = math::bn254::Fr;
+  constexpr size_t kSize = 2 * PCS::kSetupChunkSize;
+  using LargePCS = KZG<math::bn254::G1AffinePoint, kSize - 1,
+                       math::bn254::G1AffinePoint>;
+  using LargeDomain = math::UnivariateEvaluationDomain<F, kSize - 1>;
+
+  F tau = F::Random();
+  LargePCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(kSize, tau));
+
+  std::unique_ptr<LargeDomain> domain = LargeDomain::Create(kSize);
+  std::vector<F> lagrange_coeffs =
+      domain->EvaluateAllLagrangeCoefficients(tau);
+  math::bn254::G1AffinePoint g1 = math::bn254::G1AffinePoint::Generator();
+  for (size_t i : {size_t{0}, PCS::kSetupChunkSize - 1, PCS::kSetupChunkSize,
+                   kSize - 1}) {
+    SCOPED_TRACE(absl::Substitute("i: $0", i));
+    EXPECT_EQ(pcs.g1_powers_of_tau()[i], (g1 * tau.Pow(i)).ToAffine());
+    EXPECT_EQ(pcs.g1_powers_of_tau_lagrange()[i],
+              (g1 * lagrange_coeffs[i]).ToAffine());
+  }
+}
+
+TEST_F(KZGTest, UnsafeSetupWithTauInDomain) {
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N, domain->GetElement(3)));
+
+  for (size_t i = 0; i < N; ++i) {
+    EXPECT_EQ(pcs.g1_powers_of_tau_lagrange()[i],
+              i == 3 ? math::bn254::G1AffinePoint::Generator()
+                     : math::bn254::G1AffinePoint::Zero());
+  }
+}
+
+TEST_F(KZGTest, DeriveLagrangeFromMonomial) {
+  math::bn254::Fr tau = math::bn254::Fr::Random();
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N, tau));
+
+  PCS pcs;
+  ASSERT_TRUE(
+      pcs.UnsafeSetup(N, tau, PCS::LagrangeSetupMethod::kFromMonomial));
+  EXPECT_EQ(pcs.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+}
+
+TEST_F(KZGTest, UnsafeSetupWithCache) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath cache_dir = temp_dir.GetPath().Append("srs");
+
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetupWithCache(N, 1, cache_dir));
+  EXPECT_FALSE(base::IsDirectoryEmpty(cache_dir));
+
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N, PCS::GetTauFromSeed(1)));
+  EXPECT_EQ(pcs.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+
+  PCS cached;
+  ASSERT_TRUE(cached.UnsafeSetupWithCache(N, 1, cache_dir));
+  EXPECT_EQ(cached.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(cached.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+
+  PCS other;
+  ASSERT_TRUE(other.UnsafeSetupWithCache(N, 2, cache_dir));
+  EXPECT_NE(other.g1_powers_of_tau(), expected.g1_powers_of_tau());
+
+  // Once the cache of seed 1 is replaced with the one of seed 2, the SRS of
+  // seed 2 is returned for seed 1, which shows that it is read from the cache
+  // instead of being generated.
+  base::FilePath cache_path = cache_dir.Append(PCS::GetCacheName(N, 1));
+  ASSERT_TRUE(
+      base::CopyFile(cache_dir.Append(PCS::GetCacheName(N, 2)), cache_path));
+  PCS tampered;
+  ASSERT_TRUE(tampered.UnsafeSetupWithCache(N, 1, cache_dir));
+  EXPECT_EQ(tampered.g1_powers_of_tau(), other.g1_powers_of_tau());
+
+  // A broken cache is ignored and written again.
+  ASSERT_TRUE(base::WriteFile(cache_path, std::string_view("broken")));
+  PCS regenerated;
+  ASSERT_TRUE(regenerated.UnsafeSetupWithCache(N, 1, cache_dir));
+  EXPECT_EQ(regenerated.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  PCS recached;
+  ASSERT_TRUE(recached.UnsafeSetupWithCache(N, 1, cache_dir));
+  EXPECT_EQ(recached.g1_powers_of_tau(), expected.g1_powers_of_tau());
+}
+
 TEST_F(KZGTest, CommitLagrange) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
@@ -54,6 +153,30 @@ TEST_F(KZGTest, CommitLagrange) {
   EXPECT_EQ(commit, commit_lagrange);
 }
 
+TEST_F(KZGTest, CommitLagrangeSparse) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  std::vector<math::bn254::Fr> evals = {
+      math::bn254::Fr::Random(), math::bn254::Fr::Zero(),
+      math::bn254::Fr::Random(), math::bn254::Fr::Zero()};
+  std::vector<math::bn254::Fr> expanded_evals = evals;
+  expanded_evals.resize(N, math::bn254::Fr::Zero());
+
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.CommitLagrange(expanded_evals, &expected));
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(pcs.CommitLagrangeSparse(evals, &commit));
+  EXPECT_EQ(commit, expected);
+
+  ASSERT_TRUE(
+      pcs.CommitLagrangeSparse(std::vector<math::bn254::Fr>(), &commit));
+  EXPECT_TRUE(commit.IsZero());
+
+  expanded_evals.push_back(math::bn254::Fr::One());
+  EXPECT_FALSE(pcs.CommitLagrangeSparse(expanded_evals, &commit));
+}
+
 TEST_F(KZGTest, BatchCommitLagrange) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
@@ -90,6 +213,54 @@ TEST_F(KZGTest, BatchCommitLagrange) {
   EXPECT_EQ(batch_commitments, batch_commitments_lagrange);
 }
 
+TEST_F(KZGTest, BatchCommitLagrangeMulti) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  size_t num_evals = 10;
+  std::vector<Evals> evals_list =
+      base::CreateVector(num_evals, []() { return Evals::Random(N - 1); });
+  std::vector<math::bn254::G1AffinePoint> expected =
+      base::Map(evals_list, [&pcs](const Evals& evals) {
+        math::bn254::G1AffinePoint commitment;
+        CHECK(pcs.CommitLagrange(evals.evaluations(), &commitment));
+        return commitment;
+      });
+
+  // The commitments are stored after the first one, and the vectors of
+  // different sizes are committed one by one.
+  for (size_t size : {N, N - 1}) {
+    SCOPED_TRACE(absl::Substitute("size: $0", size));
+    std::vector<absl::Span<const math::bn254::Fr>> vs =
+        base::Map(evals_list, [](const Evals& evals) {
+          return absl::MakeConstSpan(evals.evaluations());
+        });
+    vs[0] = vs[0].first(size);
+
+    BatchCommitmentState state(true, num_evals + 1);
+    pcs.ResizeBatchCommitments(num_evals + 1);
+    ASSERT_TRUE(pcs.CommitLagrange(evals_list[0].evaluations(), state, 0));
+    ASSERT_TRUE(pcs.CommitLagrangeMulti(vs, state, 1));
+    std::vector<math::bn254::G1AffinePoint> batch_commitments =
+        pcs.GetBatchCommitments(state);
+    EXPECT_EQ(batch_commitments[0], expected[0]);
+    if (size == N) {
+      EXPECT_EQ(batch_commitments[1], expected[0]);
+    }
+    for (size_t i = 1; i < num_evals; ++i) {
+      EXPECT_EQ(batch_commitments[i + 1], expected[i]);
+    }
+  }
+
+  BatchCommitmentState state(true, num_evals);
+  pcs.ResizeBatchCommitments(num_evals);
+  std::vector<absl::Span<const math::bn254::Fr>> vs =
+      base::Map(evals_list, [](const Evals& evals) {
+        return absl::MakeConstSpan(evals.evaluations());
+      });
+  EXPECT_FALSE(pcs.CommitLagrangeMulti(vs, state, 1));
+}
+
 TEST_F(KZGTest, Downsize) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
@@ -14,10 +14,13 @@
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/crypto/commitments/kzg/kzg_family.h"
+#include "tachyon/crypto/commitments/kzg/kzg_pairing_accumulator.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
+#include "tachyon/math/polynomials/univariate/subproduct_tree.h"
+#include "tachyon/math/polynomials/univariate/synthetic_division.h"
 
 namespace tachyon {
 namespace zk {
@@ -49,6 +52,7 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   using Poly = typename Base::Poly;
   using Point = typename Poly::Point;
   using PointDeepRef = base::DeepRef<const Point>;
+  using PairingAccumulator = KZGPairingAccumulator<Curve>;
 
   SHPlonk() = default;
   explicit SHPlonk(KZG<G1Point, MaxDegree, Commitment>&& kzg)
@@ -70,6 +74,12 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
   }
 
+  // Checks all the pairing checks deferred to |accumulator| at once.
+  [[nodiscard]] bool VerifyPairingAccumulator(
+      const PairingAccumulator& accumulator) const {
+    return accumulator.Verify(g2_arr_);
+  }
+
  private:
   friend class VectorCommitmentScheme<SHPlonk<Curve, MaxDegree, Commitment>>;
   friend class UnivariatePolynomialCommitmentScheme<
@@ -212,8 +222,8 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     DCHECK(l_poly.Evaluate(u).IsZero());
 
     // Q(X) = L(X) / (X - u)
-    Poly vanishing_poly = Poly::FromRoots(std::vector<Field>({u}));
-    Poly& q_poly = l_poly /= vanishing_poly;
+    Poly q_poly =
+        math::DivideByVanishingPoly(std::move(l_poly), std::vector<Field>{u});
 
     // Normalize
     // Q(X) = L(X) / ((X - u) * Zᴛ\₀(u))
@@ -229,6 +239,29 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   [[nodiscard]] bool DoVerifyOpeningProof(
       const Container& poly_openings,
       TranscriptReader<Commitment>* reader) const {
+    std::array<G1Point, 2> g1_arr;
+    if (!ComputePairingInputs(poly_openings, reader, &g1_arr)) return false;
+    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+  }
+
+  // Same as above, but the final pairing check is deferred to |accumulator|.
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      PairingAccumulator* accumulator) const {
+    std::array<G1Point, 2> g1_arr;
+    if (!ComputePairingInputs(poly_openings, reader, &g1_arr)) return false;
+    accumulator->Add(g1_arr[0], g1_arr[1]);
+    return true;
+  }
+
+  // Reads the opening proof from |reader| and populates |g1_arr| with the G1
+  // points that need to satisfy e(|g1_arr[0]|, [𝜏]₂) * e(|g1_arr[1]|, [-1]₂)
+  // ≟ gᴛ⁰.
+  template <typename Container>
+  [[nodiscard]] bool ComputePairingInputs(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      std::array<G1Point, 2>* g1_arr) const {
     using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
 
     Field y = reader->SqueezeChallenge();
@@ -310,13 +343,14 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
       // |r_commitments₀| = [[R₀(u)]₁, [R₁(u)]₁, [R₂(u)]₁]
       // |r_commitments₁| = [[R₃(u)]₁]
       // |r_commitments₂| = [[R₄(u)]₁]
+      // NOTE: The tree over |points| is shared by every Rᵢ(X) of the group.
+      math::SubproductTree<Field, Poly::kMaxDegree> tree(std::move(points));
       std::vector<G1JacobianPoint> r_commitments = base::Map(
           poly_openings_vec,
-          [&points,
+          [&tree,
            &u](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
             Poly r;
-            CHECK(
-                math::LagrangeInterpolate(points, poly_openings.openings, &r));
+            CHECK(tree.Interpolate(poly_openings.openings, &r));
             return r.Evaluate(u) * G1Point::Generator();
           });
 
@@ -358,8 +392,9 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     // (𝜏 - u) * Q(𝜏) ≟ (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏) - Zᴛ(u) * H(𝜏)) / Zᴛ\₀(u)
     // (𝜏 - u) * Q(𝜏) * Zᴛ\₀(u) ≟ L(𝜏)
     // clang-format on
-    G1Point g1_arr[] = {std::move(q), p.ToAffine()};
-    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+    (*g1_arr)[0] = std::move(q);
+    (*g1_arr)[1] = p.ToAffine();
+    return true;
   }
 
   // KZGFamily methods
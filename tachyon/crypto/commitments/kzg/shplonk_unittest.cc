@@ -14,6 +14,8 @@ class SHPlonkTest : public KZGFamilyTest<PCS> {};
 
 TEST_F(SHPlonkTest, CreateAndVerifyProof) { this->CreateAndVerifyProof(); }
 
+TEST_F(SHPlonkTest, BatchVerifyProofs) { this->BatchVerifyProofs(); }
+
 TEST_F(SHPlonkTest, Copyable) { this->Copyable(); }
 
 }  // namespace tachyon::crypto
@@ -12,7 +12,8 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/ref.h"
-#include "tachyon/math/polynomials/univariate/lagrange_interpolation.h"
+#include "tachyon/math/polynomials/univariate/subproduct_tree.h"
+#include "tachyon/math/polynomials/univariate/synthetic_division.h"
 
 namespace tachyon::crypto {
 
@@ -119,9 +120,20 @@ struct GroupedPolynomialOpenings {
   // shared |points|.
   Poly CreateCombinedLowDegreeExtensions(
       const Field& r, std::vector<Poly>& low_degree_extensions) const {
-    std::vector<Point> owned_points = CreateOwnedPoints();
-    low_degree_extensions = CreateLowDegreeExtensions(owned_points);
-    return CombineLowDegreeExtensions(r, owned_points, low_degree_extensions);
+    low_degree_extensions = CreateLowDegreeExtensions(CreateSubproductTree());
+    return CreateCombinedQuotient(r);
+  }
+
+  // Same as above, but doesn't create the low degree extensions, which only
+  // shift the remainders of the division.
+  // H(X) = ((P₀(X) - R₀(X)) + r(P₁(X) - R₁(X)) + r²(P₂(X) - R₂(X))) /
+  //        (X - x₀)(X - x₁)(X - x₂)
+  Poly CreateCombinedQuotient(const Field& r) const {
+    std::vector<const Poly*> polys = base::Map(
+        poly_openings_vec, [](const PolynomialOpenings<Poly>& poly_openings) {
+          return poly_openings.poly_oracle.get();
+        });
+    return math::CombineAndDivideByVanishingPoly(polys, r, CreateOwnedPoints());
   }
 
   bool operator==(const GroupedPolynomialOpenings& other) const {
@@ -135,8 +147,10 @@ struct GroupedPolynomialOpenings {
  private:
   FRIEND_TEST(PolynomialOpeningsTest, CreateCombinedLowDegreeExtensions);
 
+  using SubproductTree = math::SubproductTree<Field, Poly::kMaxDegree>;
+
   // TODO(chokobole): Since |CreateLowDegreeExtensions()| and
-  // |CombineLowDegreeExtensions()| internally access to |Point| with an
+  // |CreateCombinedQuotient()| internally access to |Point| with an
   // indexing operator, if we use a vector of |base::DeepRef<const Point>| it
   // can't access as we expect.
   std::vector<Point> CreateOwnedPoints() const {
@@ -144,41 +158,25 @@ struct GroupedPolynomialOpenings {
                      [](const base::DeepRef<const Point>& p) { return *p; });
   }
 
+  // The tree is built once over the shared |points| and reused by every
+  // polynomial in |poly_openings_vec|.
+  SubproductTree CreateSubproductTree() const {
+    return SubproductTree(CreateOwnedPoints());
+  }
+
   // Create a set of low degree extensions based on every
   // |poly_openings.openings| and shared |points|.
   std::vector<Poly> CreateLowDegreeExtensions(
-      const std::vector<Point>& owned_points) const {
+      const SubproductTree& tree) const {
     return base::Map(
         poly_openings_vec,
-        [&owned_points](const PolynomialOpenings<Poly>& poly_openings) {
+        [&tree](const PolynomialOpenings<Poly>& poly_openings) {
           Poly low_degree_extension;
-          CHECK(math::LagrangeInterpolate(owned_points, poly_openings.openings,
-                                          &low_degree_extension));
+          CHECK(tree.Interpolate(poly_openings.openings,
+                                 &low_degree_extension));
           return low_degree_extension;
         });
   }
-
-  Poly CombineLowDegreeExtensions(
-      const Field& r, const std::vector<Point>& owned_points,
-      const std::vector<Poly>& low_degree_extensions) const {
-    // numerators: [P₀(X) - R₀(X), P₁(X) - R₁(X), P₂(X) - R₂(X)]
-    std::vector<Poly> numerators = base::Map(
-        poly_openings_vec,
-        [&low_degree_extensions](
-            size_t i, const PolynomialOpenings<Poly>& poly_openings) {
-          return *poly_openings.poly_oracle - low_degree_extensions[i];
-        });
-
-    // Combine numerator polynomials with powers of |r|.
-    // N(X) = (P₀(X) - R₀(X)) + r(P₁(X) - R₁(X)) + r²(P₂(X) - R₂(X))
-    Poly& n = Poly::template LinearCombinationInPlace</*forward=*/false>(
-        numerators, r);
-
-    // Divide combined polynomial by vanishing polynomial of evaluation points.
-    // H(X) = N(X) / (X - x₀)(X - x₁)(X - x₂)
-    Poly vanishing_poly = Poly::FromRoots(owned_points);
-    return n /= vanishing_poly;
-  }
 };
 
 template <typename Poly, typename PolyOracle = Poly>
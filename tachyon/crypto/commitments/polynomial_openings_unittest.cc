@@ -59,9 +59,9 @@ TEST_F(PolynomialOpeningsTest, CreateCombinedLowDegreeExtensions) {
 
   // NOTE(chokobole): Check whether the manually created low degree extensions
   // are constructed correctly.
-  std::vector<Point> owned_points = grouped_poly_opening.CreateOwnedPoints();
+  auto tree = grouped_poly_opening.CreateSubproductTree();
   std::vector<Poly> low_degree_extensions =
-      grouped_poly_opening.CreateLowDegreeExtensions(owned_points);
+      grouped_poly_opening.CreateLowDegreeExtensions(tree);
   for (size_t i = 0; i < low_degree_extensions.size(); ++i) {
     const Poly& low_degree_extension = low_degree_extensions[i];
     const PolynomialOpenings<Poly>& poly_openings =
@@ -77,8 +77,7 @@ TEST_F(PolynomialOpeningsTest, CreateCombinedLowDegreeExtensions) {
   // and returned ones are same.
   GF7 r = GF7::Random();
   Poly combined_low_degree_extension =
-      grouped_poly_opening.CombineLowDegreeExtensions(r, owned_points,
-                                                      low_degree_extensions);
+      grouped_poly_opening.CreateCombinedQuotient(r);
   std::vector<Poly> actual_low_degree_extensions;
   EXPECT_EQ(combined_low_degree_extension,
             grouped_poly_opening.CreateCombinedLowDegreeExtensions(
@@ -99,7 +98,7 @@ TEST_F(PolynomialOpeningsTest, CreateCombinedLowDegreeExtensions) {
         power;
     power *= r;
   }
-  for (const Point& point : owned_points) {
+  for (const Point& point : tree.points()) {
     expected_eval /= (x - point);
   }
   EXPECT_EQ(actual_eval, expected_eval);
@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -53,6 +55,17 @@ class UnivariatePolynomialCommitmentScheme
     return derived->DoCommitLagrange(evals, result);
   }
 
+  // Commit to |evals|, which may be shorter than |N()| with the rest
+  // regarded as zero, and populates |result| with the commitment. Unlike
+  // |CommitLagrange()|, the zero evaluations are skipped, so it is cheaper
+  // when |evals| are mostly zero. Return false if |evals| is longer than
+  // |N()|.
+  [[nodiscard]] bool CommitLagrangeSparse(const Evals& evals,
+                                          Commitment* result) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoCommitLagrangeSparse(evals, result);
+  }
+
   // Commit to |evals| and stores the commitment in |batch_commitments_| at
   // |index| if |batch_mode| is true. Return false if the degree of |evals|
   // exceeds |kMaxDegree|. It terminates when |batch_mode| is false.
@@ -64,6 +77,21 @@ class UnivariatePolynomialCommitmentScheme
     return derived->DoCommitLagrange(evals, derived->batch_commitment_state(),
                                      index);
   }
+
+  // Commit to every evals of |evals_list| and stores the commitments in
+  // |batch_commitments_| from |index| if |batch_mode| is true. Unlike
+  // calling |CommitLagrange()| per evals, they can share a pass over the
+  // parameters. Return false if the degree of any evals exceeds
+  // |kMaxDegree|. It terminates when |batch_mode| is false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool CommitLagrangeMulti(
+      absl::Span<const Evals* const> evals_list, size_t index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoCommitLagrangeMulti(
+        evals_list, derived->batch_commitment_state(), index);
+  }
 };
 
 }  // namespace tachyon::crypto
@@ -161,6 +161,15 @@ class VectorCommitmentScheme {
     return derived->DoVerifyOpeningProof(members, proof);
   }
 
+  // Verify multi-openings |proof|, but defer the final check to |accumulator|
+  // so that it can be batched with the ones of other proofs.
+  template <typename Container, typename Proof, typename Accumulator>
+  [[nodiscard]] bool VerifyOpeningProof(const Container& members, Proof* proof,
+                                        Accumulator* accumulator) const {
+    const Derived* derived = static_cast<const Derived*>(this);
+    return derived->DoVerifyOpeningProof(members, proof, accumulator);
+  }
+
  protected:
   BatchCommitmentState batch_commitment_state_;
 };
@@ -0,0 +1,126 @@
+#ifndef TACHYON_CRYPTO_SUMCHECK_LIST_OF_PRODUCTS_H_
+#define TACHYON_CRYPTO_SUMCHECK_LIST_OF_PRODUCTS_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/polynomials/multivariate/multilinear_dense_evaluations.h"
+
+namespace tachyon::crypto {
+
+// |ListOfProducts| represents Σⱼ cⱼ * Πₖ fⱼ,ₖ(x), a sum of products of
+// multilinear polynomials over the same number of variables. The multilinear
+// polynomials are stored once and referred to by index, so that a polynomial
+// shared by several products is folded only once by the sumcheck prover.
+//
+//   ListOfProducts<F, kMaxDegree> poly(num_variables);
+//   size_t a = poly.AddMLE(std::move(a_evals));
+//   size_t b = poly.AddMLE(std::move(b_evals));
+//   size_t c = poly.AddMLE(std::move(c_evals));
+//   // a(x) * b(x) - c(x)
+//   poly.AddProduct(F::One(), {a, b});
+//   poly.AddProduct(-F::One(), {c});
+template <typename F, size_t MaxDegree>
+class ListOfProducts {
+ public:
+  using MLE = math::MultilinearDenseEvaluations<F, MaxDegree>;
+
+  struct Product {
+    F coefficient;
+    std::vector<size_t> indices;
+  };
+
+  ListOfProducts() = default;
+  explicit ListOfProducts(size_t num_variables)
+      : num_variables_(num_variables) {
+    CHECK_LE(num_variables, MaxDegree);
+  }
+
+  size_t num_variables() const { return num_variables_; }
+  // The degree of the round polynomials, which is the number of the
+  // multilinear polynomials in the largest product.
+  size_t max_degree() const { return max_degree_; }
+  const std::vector<MLE>& mles() const { return mles_; }
+  std::vector<MLE>& mles() { return mles_; }
+  const std::vector<Product>& products() const { return products_; }
+
+  // Adds a multilinear polynomial and returns its index.
+  size_t AddMLE(MLE&& mle) {
+    CHECK_LE(mle.Degree(), num_variables_);
+    // NOTE: The missing evaluations are zeros. See |MLE::operator[]|.
+    mle.evaluations().resize(size_t{1} << num_variables_, F::Zero());
+    mles_.push_back(std::move(mle));
+    return mles_.size() - 1;
+  }
+
+  // Adds |coefficient| * Πₖ fₖ(x), where fₖ is the multilinear polynomial at
+  // |indices[k]|.
+  void AddProduct(const F& coefficient, std::vector<size_t>&& indices) {
+    CHECK(!indices.empty());
+    for (size_t index : indices) {
+      CHECK_LT(index, mles_.size());
+    }
+    max_degree_ = std::max(max_degree_, indices.size());
+    products_.push_back({coefficient, std::move(indices)});
+  }
+
+  F Evaluate(absl::Span<const F> point) const {
+    std::vector<F> evals = base::Map(
+        mles_, [point](const MLE& mle) { return mle.Evaluate(point); });
+    return EvaluateProducts(evals);
+  }
+
+  // Returns Σₓ Σⱼ cⱼ * Πₖ fⱼ,ₖ(x) over x in {0, 1}ⁿ.
+  F SumOverBooleanHypercube() const {
+    if (mles_.empty()) return F::Zero();
+    absl::Span<const F> first = mles_[0].evaluations();
+    std::vector<F> sums = base::ParallelizeMap(
+        first, [this](absl::Span<const F> chunk, size_t chunk_index,
+                      size_t chunk_size) {
+          size_t offset = chunk_index * chunk_size;
+          std::vector<F> evals(mles_.size());
+          F sum = F::Zero();
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            for (size_t k = 0; k < mles_.size(); ++k) {
+              evals[k] = mles_[k].evaluations()[offset + i];
+            }
+            sum += EvaluateProducts(evals);
+          }
+          return sum;
+        });
+    return std::accumulate(sums.begin(), sums.end(), F::Zero(),
+                           [](F& acc, const F& sum) { return acc += sum; });
+  }
+
+ private:
+  // Returns Σⱼ cⱼ * Πₖ |evals|[indices[k]].
+  F EvaluateProducts(const std::vector<F>& evals) const {
+    F ret = F::Zero();
+    for (const Product& product : products_) {
+      F term = product.coefficient;
+      for (size_t index : product.indices) {
+        term *= evals[index];
+      }
+      ret += term;
+    }
+    return ret;
+  }
+
+  size_t num_variables_ = 0;
+  size_t max_degree_ = 0;
+  std::vector<MLE> mles_;
+  std::vector<Product> products_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_LIST_OF_PRODUCTS_H_
@@ -0,0 +1,138 @@
+#ifndef TACHYON_CRYPTO_SUMCHECK_SUMCHECK_PROVER_H_
+#define TACHYON_CRYPTO_SUMCHECK_SUMCHECK_PROVER_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/crypto/sumcheck/list_of_products.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+
+namespace tachyon::crypto {
+
+// |SumcheckProver| proves Σₓ g(x) = H over x in {0, 1}ⁿ, where g is a
+// |ListOfProducts| of degree d.
+//
+// In the i-th round, it sends the evaluations of the round polynomial
+// gᵢ(X) = Σ g(x₀, ..., xₙ₋ᵢ₋₂, X, rᵢ₋₁, ..., r₀) at X = 0, 1, ..., d and
+// fixes xₙ₋ᵢ₋₁ to the challenge rᵢ. The variables are fixed from the last
+// one, so that every multilinear polynomial is folded in place by
+// |FixLastVariablesInPlace()| without any allocation.
+template <typename F, size_t MaxDegree>
+class SumcheckProver {
+ public:
+  using MLE = typename ListOfProducts<F, MaxDegree>::MLE;
+  using Product = typename ListOfProducts<F, MaxDegree>::Product;
+
+  explicit SumcheckProver(ListOfProducts<F, MaxDegree>&& poly)
+      : poly_(std::move(poly)) {}
+
+  // Evaluations of the multilinear polynomials at the point returned by
+  // |Prove()|. These are what the verifier is left to check against
+  // |SumcheckSubClaim::expected_evaluation|.
+  const std::vector<F>& mle_evaluations() const { return mle_evaluations_; }
+
+  // Runs the protocol with Fiat-Shamir and writes the round polynomials to
+  // |writer|. |point| is set to the challenges in little-endian form, that is,
+  // (r₀, ..., rₙ₋₁) is stored as (xₙ₋₁, ..., x₀) = (r₀, ..., rₙ₋₁).
+  template <typename Commitment, bool FieldAndCommitmentAreSameType>
+  [[nodiscard]] bool Prove(
+      TranscriptWriterImpl<Commitment, FieldAndCommitmentAreSameType>* writer,
+      std::vector<F>* point) {
+    size_t n = poly_.num_variables();
+    size_t d = poly_.max_degree();
+    if (poly_.mles().empty()) {
+      LOG(ERROR) << "No multilinear polynomials to prove";
+      return false;
+    }
+
+    *point = std::vector<F>(n);
+    for (size_t i = 0; i < n; ++i) {
+      std::vector<F> round_evals = ComputeRoundEvaluations(n - i - 1, d);
+      for (const F& eval : round_evals) {
+        if (!writer->WriteToProof(eval)) return false;
+      }
+      F r = writer->SqueezeChallenge();
+      for (MLE& mle : poly_.mles()) {
+        mle.FixLastVariablesInPlace({r});
+      }
+      (*point)[n - i - 1] = r;
+    }
+
+    mle_evaluations_ =
+        base::Map(poly_.mles(), [](const MLE& mle) { return mle[0]; });
+    return true;
+  }
+
+ private:
+  // Returns gᵢ(t) for t in [0, |d|], where the multilinear polynomials are
+  // left with |num_free_variables| + 1 variables.
+  std::vector<F> ComputeRoundEvaluations(size_t num_free_variables,
+                                         size_t d) const {
+    const std::vector<MLE>& mles = poly_.mles();
+    const std::vector<Product>& products = poly_.products();
+    size_t half = size_t{1} << num_free_variables;
+    absl::Span<const F> lower =
+        absl::MakeConstSpan(mles[0].evaluations()).subspan(0, half);
+
+    std::vector<std::vector<F>> chunk_sums = base::ParallelizeMap(
+        lower, [&mles, &products, half, d](absl::Span<const F> chunk,
+                                           size_t chunk_index,
+                                           size_t chunk_size) {
+          std::vector<F> sums(d + 1, F::Zero());
+          // |values|[k * (d + 1) + t] = fₖ(..., t, ...)
+          std::vector<F> values(mles.size() * (d + 1));
+          std::vector<F> terms(d + 1);
+          size_t offset = chunk_index * chunk_size;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            size_t b = offset + i;
+            // fₖ(..., t, ...) = fₖ(..., 0, ...) + t * (fₖ(..., 1, ...) -
+            //                   fₖ(..., 0, ...))
+            for (size_t k = 0; k < mles.size(); ++k) {
+              const std::vector<F>& evals = mles[k].evaluations();
+              F* v = &values[k * (d + 1)];
+              F step = evals[b + half] - evals[b];
+              v[0] = evals[b];
+              for (size_t t = 1; t <= d; ++t) {
+                v[t] = v[t - 1] + step;
+              }
+            }
+            for (const Product& product : products) {
+              std::fill(terms.begin(), terms.end(), product.coefficient);
+              for (size_t index : product.indices) {
+                const F* v = &values[index * (d + 1)];
+                for (size_t t = 0; t <= d; ++t) {
+                  terms[t] *= v[t];
+                }
+              }
+              for (size_t t = 0; t <= d; ++t) {
+                sums[t] += terms[t];
+              }
+            }
+          }
+          return sums;
+        });
+
+    std::vector<F> ret(d + 1, F::Zero());
+    for (const std::vector<F>& sums : chunk_sums) {
+      for (size_t t = 0; t <= d; ++t) {
+        ret[t] += sums[t];
+      }
+    }
+    return ret;
+  }
+
+  ListOfProducts<F, MaxDegree> poly_;
+  std::vector<F> mle_evaluations_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_SUMCHECK_PROVER_H_
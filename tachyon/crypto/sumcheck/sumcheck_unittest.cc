@@ -0,0 +1,92 @@
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/crypto/sumcheck/sumcheck_prover.h"
+#include "tachyon/crypto/sumcheck/sumcheck_verifier.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = 10;
+constexpr size_t kNumVariables = 6;
+
+using Poly = ListOfProducts<F, kMaxDegree>;
+using MLE = Poly::MLE;
+
+class SumcheckTest : public math::FiniteFieldTest<F> {
+ public:
+  void SetUp() override {
+    poly_ = Poly(kNumVariables);
+    size_t a = poly_.AddMLE(MLE::Random(kNumVariables));
+    size_t b = poly_.AddMLE(MLE::Random(kNumVariables));
+    size_t c = poly_.AddMLE(MLE::Random(kNumVariables));
+    size_t d = poly_.AddMLE(MLE::Random(kNumVariables));
+    // 3 * a(x) * b(x) * c(x) + a(x) * d(x) - 5 * c(x)
+    poly_.AddProduct(F(3), {a, b, c});
+    poly_.AddProduct(F::One(), {a, d});
+    poly_.AddProduct(-F(5), {c});
+  }
+
+ protected:
+  Poly poly_;
+};
+
+}  // namespace
+
+TEST_F(SumcheckTest, ProveAndVerify) {
+  F claimed_sum = poly_.SumOverBooleanHypercube();
+  ASSERT_EQ(poly_.max_degree(), size_t{3});
+
+  SumcheckProver<F, kMaxDegree> prover((Poly(poly_)));
+  SimpleTranscriptWriter<F> writer((base::Uint8VectorBuffer()));
+  std::vector<F> prover_point;
+  ASSERT_TRUE(prover.Prove(&writer, &prover_point));
+
+  SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+  reader.buffer().set_buffer_offset(0);
+  SumcheckSubClaim<F> subclaim;
+  ASSERT_TRUE(VerifySumcheck(kNumVariables, poly_.max_degree(), claimed_sum,
+                             &reader, &subclaim));
+  EXPECT_EQ(subclaim.point, prover_point);
+  EXPECT_EQ(subclaim.expected_evaluation, poly_.Evaluate(subclaim.point));
+
+  const std::vector<F>& mle_evaluations = prover.mle_evaluations();
+  ASSERT_EQ(mle_evaluations.size(), poly_.mles().size());
+  for (size_t i = 0; i < mle_evaluations.size(); ++i) {
+    EXPECT_EQ(mle_evaluations[i], poly_.mles()[i].Evaluate(subclaim.point));
+  }
+}
+
+TEST_F(SumcheckTest, WrongClaimedSum) {
+  F claimed_sum = poly_.SumOverBooleanHypercube() + F::One();
+
+  SumcheckProver<F, kMaxDegree> prover((Poly(poly_)));
+  SimpleTranscriptWriter<F> writer((base::Uint8VectorBuffer()));
+  std::vector<F> point;
+  ASSERT_TRUE(prover.Prove(&writer, &point));
+
+  SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+  reader.buffer().set_buffer_offset(0);
+  SumcheckSubClaim<F> subclaim;
+  EXPECT_FALSE(VerifySumcheck(kNumVariables, poly_.max_degree(), claimed_sum,
+                              &reader, &subclaim));
+}
+
+TEST_F(SumcheckTest, InterpolateAndEvaluate) {
+  // g(X) = X³ + 2X + 7
+  auto g = [](const F& x) { return x.Square() * x + x.Double() + F(7); };
+  std::vector<F> evals = {g(F(0)), g(F(1)), g(F(2)), g(F(3))};
+  F r = F::Random();
+  EXPECT_EQ(internal::InterpolateAndEvaluate(absl::MakeConstSpan(evals), r),
+            g(r));
+}
+
+}  // namespace tachyon::crypto
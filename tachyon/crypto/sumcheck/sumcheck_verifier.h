@@ -0,0 +1,99 @@
+#ifndef TACHYON_CRYPTO_SUMCHECK_SUMCHECK_VERIFIER_H_
+#define TACHYON_CRYPTO_SUMCHECK_SUMCHECK_VERIFIER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+
+namespace tachyon::crypto {
+
+// What is left to the verifier after the sumcheck rounds: g(|point|) has to be
+// equal to |expected_evaluation|. This is usually checked by an opening of
+// the multilinear polynomials or by the next layer of a GKR style protocol.
+template <typename F>
+struct SumcheckSubClaim {
+  std::vector<F> point;
+  F expected_evaluation;
+};
+
+namespace internal {
+
+// Evaluates the polynomial of degree |evals.size()| - 1, whose evaluations at
+// 0, 1, ..., |evals.size()| - 1 are |evals|, at |r| by the lagrange
+// interpolation.
+template <typename F>
+F InterpolateAndEvaluate(absl::Span<const F> evals, const F& r) {
+  size_t d = evals.size() - 1;
+  // prefix[i] = Πⱼ<ᵢ (r - j), suffix[i] = Πⱼ>ᵢ (r - j)
+  std::vector<F> prefix(d + 1);
+  std::vector<F> suffix(d + 1);
+  prefix[0] = F::One();
+  for (size_t i = 1; i <= d; ++i) {
+    prefix[i] = prefix[i - 1] * (r - F(static_cast<uint64_t>(i - 1)));
+  }
+  suffix[d] = F::One();
+  for (size_t i = d; i > 0; --i) {
+    suffix[i - 1] = suffix[i] * (r - F(static_cast<uint64_t>(i)));
+  }
+  // Πⱼ≠ᵢ (i - j) = i! * (d - i)! * (-1)ᵈ⁻ⁱ
+  std::vector<F> factorials(d + 1);
+  factorials[0] = F::One();
+  for (size_t i = 1; i <= d; ++i) {
+    factorials[i] = factorials[i - 1] * F(static_cast<uint64_t>(i));
+  }
+  F ret = F::Zero();
+  for (size_t i = 0; i <= d; ++i) {
+    F denominator = factorials[i] * factorials[d - i];
+    if ((d - i) % 2 == 1) denominator.NegInPlace();
+    ret += evals[i] * prefix[i] * suffix[i] * denominator.Inverse();
+  }
+  return ret;
+}
+
+}  // namespace internal
+
+// Verifies a proof written by |SumcheckProver::Prove()| that Σₓ g(x) is
+// |claimed_sum| over x in {0, 1}ⁿ, where n is |num_variables| and |degree| is
+// the degree of g in each variable. On success, |subclaim| is set to the claim
+// left to check.
+template <typename Commitment, bool FieldAndCommitmentAreSameType,
+          typename F = typename TranscriptTraits<Commitment>::Field>
+[[nodiscard]] bool VerifySumcheck(
+    size_t num_variables, size_t degree, const F& claimed_sum,
+    TranscriptReaderImpl<Commitment, FieldAndCommitmentAreSameType>* reader,
+    SumcheckSubClaim<F>* subclaim) {
+  if (degree == 0) {
+    LOG(ERROR) << "The degree of the round polynomials must be positive";
+    return false;
+  }
+  std::vector<F> point(num_variables);
+  std::vector<F> round_evals(degree + 1);
+  F claim = claimed_sum;
+  for (size_t i = 0; i < num_variables; ++i) {
+    for (F& eval : round_evals) {
+      if (!reader->ReadFromProof(&eval)) return false;
+    }
+    if (round_evals[0] + round_evals[1] != claim) {
+      LOG(ERROR) << "Sumcheck failed at round " << i;
+      return false;
+    }
+    F r = reader->SqueezeChallenge();
+    claim = internal::InterpolateAndEvaluate(absl::MakeConstSpan(round_evals),
+                                             r);
+    point[num_variables - i - 1] = r;
+  }
+  subclaim->point = std::move(point);
+  subclaim->expected_evaluation = std::move(claim);
+  return true;
+}
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SUMCHECK_SUMCHECK_VERIFIER_H_
@@ -9,6 +9,8 @@
 
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/vector_buffer.h"
 #include "tachyon/crypto/transcripts/transcript_traits.h"
 
@@ -44,6 +46,26 @@ class TranscriptImpl<_Commitment, false> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |commitments| to the transcript in order. It is the same as writing
+  // them one by one, but the implementations may absorb them in a batch.
+  [[nodiscard]] virtual bool BatchWriteToTranscript(
+      absl::Span<const Commitment> commitments) {
+    for (const Commitment& commitment : commitments) {
+      if (!WriteToTranscript(commitment)) return false;
+    }
+    return true;
+  }
+
+  // Write |values| to the transcript in order. It is the same as writing them
+  // one by one, but the implementations may absorb them in a batch.
+  [[nodiscard]] virtual bool BatchWriteToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Commitment, false>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Commitment, false>*>(this);
   }
@@ -75,6 +97,16 @@ class TranscriptImpl<_Field, true> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |values| to the transcript in order. It is the same as writing them
+  // one by one, but the implementations may absorb them in a batch.
+  [[nodiscard]] virtual bool BatchWriteToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Field, true>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Field, true>*>(this);
   }
@@ -194,6 +226,30 @@ class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |commitments| to the proof. Note that it also writes the
+  // |commitments| to the transcript in a batch by calling
+  // |BatchWriteToTranscript()| internally.
+  [[nodiscard]] bool WriteToProof(absl::Span<const Commitment> commitments) {
+    if (!this->BatchWriteToTranscript(commitments)) return false;
+    for (const Commitment& commitment : commitments) {
+      VLOG(3) << "Proof[" << proof_idx_++
+              << "]: " << commitment.ToHexString(true);
+      if (!DoWriteToProof(commitment)) return false;
+    }
+    return true;
+  }
+
+  // Write |values| to the proof. Note that it also writes the |values| to the
+  // transcript in a batch by calling |BatchWriteToTranscript()| internally.
+  [[nodiscard]] bool WriteToProof(absl::Span<const Field> values) {
+    if (!this->BatchWriteToTranscript(values)) return false;
+    for (const Field& value : values) {
+      VLOG(3) << "Proof[" << proof_idx_++ << "]: " << value.ToHexString(true);
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
  protected:
   //  Write a |commitment| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Commitment& commitment) = 0;
@@ -227,6 +283,17 @@ class TranscriptWriterImpl<Field, true> : public Transcript<Field> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |values| to the proof. Note that it also writes the |values| to the
+  // transcript in a batch by calling |BatchWriteToTranscript()| internally.
+  [[nodiscard]] bool WriteToProof(absl::Span<const Field> values) {
+    if (!this->BatchWriteToTranscript(values)) return false;
+    for (const Field& value : values) {
+      VLOG(3) << "Proof[" << proof_idx_++ << "]: " << value.ToHexString(true);
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
  protected:
   //  Write a |value| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Field& value) = 0;
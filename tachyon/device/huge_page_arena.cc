@@ -0,0 +1,203 @@
+#include "tachyon/device/huge_page_arena.h"
+
+#include <sys/mman.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/build/build_config.h"
+
+#if BUILDFLAG(IS_LINUX) && !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace tachyon::device {
+
+namespace {
+
+// NOTE: The current arena is per thread, so that a prover running on another
+// thread neither allocates from it nor restores it out of order.
+thread_local HugePageArena* g_current_arena = nullptr;
+
+constexpr size_t kRegularPageSize = size_t{1} << 12;
+
+}  // namespace
+
+HugePageArena::HugePageArena(const Options& options) : options_(options) {}
+
+HugePageArena::~HugePageArena() {
+  DCHECK_EQ(num_live_allocations_, size_t{0});
+  for (const Block& block : blocks_) {
+    munmap(block.data, block.size);
+  }
+}
+
+// static
+HugePageArena* HugePageArena::GetCurrent() {
+  return g_current_arena;
+}
+
+void* HugePageArena::AllocateRaw(size_t alignment, size_t num_bytes) {
+  DCHECK(base::bits::IsPowerOfTwo(alignment));
+  std::unique_lock<std::mutex> lock(mutex_);
+  // NOTE: Every allocation takes at least a byte so that it gets a pointer
+  // of its own.
+  num_bytes = std::max(num_bytes, size_t{1});
+
+  // Finds the first block with enough room starting from the current one.
+  size_t offset = 0;
+  while (block_index_ < blocks_.size()) {
+    offset = base::bits::AlignUp(offset_, alignment);
+    if (offset + num_bytes <= blocks_[block_index_].size) break;
+    ++block_index_;
+    offset_ = 0;
+  }
+  if (block_index_ == blocks_.size()) {
+    Block block;
+    if (!MapBlock(std::max(num_bytes, options_.block_size), &block)) {
+      return nullptr;
+    }
+    blocks_.push_back(block);
+    stats_.bytes_reserved += block.size;
+    stats_.peak_bytes_reserved =
+        std::max(stats_.peak_bytes_reserved, stats_.bytes_reserved);
+    offset = 0;
+  }
+
+  Block& block = blocks_[block_index_];
+  uint8_t* data = block.data + offset;
+  // The pages in [|touch_begin|, |touch_end|) are first touched by this
+  // allocation.
+  size_t touch_begin = std::max(offset, block.touched_size);
+  size_t touch_end = offset + num_bytes;
+  size_t page_size = GetPageSizeInBytes(block.page_size);
+  if (num_bytes >= options_.first_touch_threshold) {
+    block.touched_size = std::max(block.touched_size, touch_end);
+  } else {
+    touch_end = touch_begin;
+  }
+  offset_ = offset + num_bytes;
+  ++num_live_allocations_;
+
+  ++stats_.num_allocs;
+  stats_.bytes_in_use += num_bytes;
+  stats_.peak_bytes_in_use =
+      std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+  stats_.largest_alloc_size =
+      std::max(stats_.largest_alloc_size, static_cast<int64_t>(num_bytes));
+
+  // NOTE: The pages are touched without the lock, since the thread waiting
+  // for the parallel loop may run another task that allocates from this
+  // arena.
+  lock.unlock();
+  if (touch_begin < touch_end) {
+    TouchPages(data - offset + touch_begin, touch_end - touch_begin,
+               page_size);
+  }
+  return data;
+}
+
+void HugePageArena::DeallocateRaw(void* ptr) {
+  if (ptr == nullptr) return;
+  std::lock_guard<std::mutex> lock(mutex_);
+  DCHECK_GT(num_live_allocations_, size_t{0});
+  if (--num_live_allocations_ == 0) {
+    // NOTE: The blocks are kept, so that the next allocations don't fault
+    // the pages in again.
+    block_index_ = 0;
+    offset_ = 0;
+    stats_.bytes_in_use = 0;
+  }
+}
+
+std::optional<AllocatorStats> HugePageArena::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+bool HugePageArena::ClearStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.num_allocs = 0;
+  stats_.peak_bytes_in_use = stats_.bytes_in_use;
+  stats_.largest_alloc_size = 0;
+  stats_.peak_bytes_reserved = stats_.bytes_reserved;
+  return true;
+}
+
+// static
+size_t HugePageArena::GetPageSizeInBytes(PageSize page_size) {
+  switch (page_size) {
+    case PageSize::kDefault:
+      return kRegularPageSize;
+    case PageSize::k2MB:
+      return size_t{1} << 21;
+    case PageSize::k1GB:
+      return size_t{1} << 30;
+  }
+  NOTREACHED();
+  return kRegularPageSize;
+}
+
+bool HugePageArena::MapBlock(size_t num_bytes, Block* block) const {
+#if BUILDFLAG(IS_LINUX)
+  for (PageSize page_size : {PageSize::k1GB, PageSize::k2MB}) {
+    if (page_size > options_.page_size) continue;
+    size_t page_size_in_bytes = GetPageSizeInBytes(page_size);
+    size_t size = base::bits::AlignUp(num_bytes, page_size_in_bytes);
+    int log_page_size = page_size == PageSize::k1GB ? 30 : 21;
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                          (log_page_size << MAP_HUGE_SHIFT),
+                      -1, 0);
+    if (data != MAP_FAILED) {
+      *block = {static_cast<uint8_t*>(data), size, page_size, 0};
+      return true;
+    }
+    VLOG(1) << "No huge pages of " << page_size_in_bytes
+            << " bytes are available for " << size << " bytes";
+  }
+#endif  // BUILDFLAG(IS_LINUX)
+
+  // NOTE: The size is rounded up to 2 MB so that the whole block can be
+  // backed by transparent huge pages.
+  size_t size = base::bits::AlignUp(num_bytes, size_t{1} << 21);
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) {
+    LOG(ERROR) << "Failed to map " << size << " bytes";
+    return false;
+  }
+#if BUILDFLAG(IS_LINUX)
+  if (madvise(data, size, MADV_HUGEPAGE) != 0) {
+    VLOG(1) << "Transparent huge pages aren't available";
+  }
+#endif  // BUILDFLAG(IS_LINUX)
+  *block = {static_cast<uint8_t*>(data), size, PageSize::kDefault, 0};
+  return true;
+}
+
+// static
+void HugePageArena::TouchPages(uint8_t* data, size_t size, size_t page_size) {
+  absl::Span<uint8_t> range(data, size);
+  base::Parallelize(range, [page_size](absl::Span<uint8_t> chunk) {
+    for (size_t i = 0; i < chunk.size(); i += page_size) {
+      chunk[i] = 0;
+    }
+  });
+}
+
+ScopedHugePageArena::ScopedHugePageArena(HugePageArena* arena)
+    : arena_(arena), previous_(g_current_arena) {
+  g_current_arena = arena;
+}
+
+ScopedHugePageArena::~ScopedHugePageArena() {
+  // NOTE: The scopes of a thread are nested, so the previous arena is still
+  // alive.
+  DCHECK_EQ(g_current_arena, arena_);
+  g_current_arena = previous_;
+}
+
+}  // namespace tachyon::device
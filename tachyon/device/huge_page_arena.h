@@ -0,0 +1,169 @@
+#ifndef TACHYON_DEVICE_HUGE_PAGE_ARENA_H_
+#define TACHYON_DEVICE_HUGE_PAGE_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "tachyon/device/allocator.h"
+#include "tachyon/export.h"
+
+namespace tachyon::device {
+
+// An arena that serves the large scratch buffers of the MSMs of a proof, e.g.,
+// the scalars and their signed digits, out of blocks backed by huge pages.
+// The polynomials, the evaluations and the table columns of a proof aren't
+// served by it and are still allocated from the default heap.
+//
+// A block is mapped with 1 GB or 2 MB huge pages if the kernel has them
+// reserved, and falls back to regular pages advised to be merged into
+// transparent huge pages otherwise. Allocations are bumped from the blocks,
+// and once every allocation is deallocated, the arena rewinds to the first
+// block, so that the next allocations reuse the pages that are already
+// faulted in. The blocks are unmapped when the arena is destroyed.
+//
+// The pages of a large allocation are first touched in parallel in the same
+// contiguous chunks |base::Parallelize()| hands out to the threads, so that
+// each of them lands on the NUMA node of the thread which works on it later.
+class TACHYON_EXPORT HugePageArena : public Allocator {
+ public:
+  enum class PageSize {
+    // Regular pages with transparent huge pages advised.
+    kDefault,
+    k2MB,
+    k1GB,
+  };
+
+  struct Options {
+    // The largest page size to try. The smaller ones are tried in order if
+    // it fails.
+    PageSize page_size = PageSize::k2MB;
+    // The minimum size of a block. A larger allocation gets a block of its
+    // own size.
+    size_t block_size = size_t{1} << 30;
+    // Allocations of at least this size are first touched in parallel.
+    size_t first_touch_threshold = size_t{1} << 20;
+  };
+
+  explicit HugePageArena(const Options& options);
+  HugePageArena(const HugePageArena& other) = delete;
+  HugePageArena& operator=(const HugePageArena& other) = delete;
+  ~HugePageArena() override;
+
+  // Returns the arena installed by |ScopedHugePageArena| on the current
+  // thread, or nullptr if there is none.
+  static HugePageArena* GetCurrent();
+
+  // Allocator methods
+  std::string Name() override { return "huge_page_arena"; }
+  void* AllocateRaw(size_t alignment, size_t num_bytes) override;
+  void DeallocateRaw(void* ptr) override;
+  std::optional<AllocatorStats> GetStats() override;
+  bool ClearStats() override;
+  AllocatorMemoryType GetMemoryType() const override {
+    return AllocatorMemoryType::kHostPageable;
+  }
+
+ private:
+  struct Block {
+    uint8_t* data;
+    size_t size;
+    PageSize page_size;
+    // The end of the pages first touched in parallel so far.
+    size_t touched_size;
+  };
+
+  static size_t GetPageSizeInBytes(PageSize page_size);
+
+  // Maps a block of at least |num_bytes|. Returns false if it fails even
+  // with the regular pages.
+  bool MapBlock(size_t num_bytes, Block* block) const;
+  // Writes to every page of |data| in parallel.
+  static void TouchPages(uint8_t* data, size_t size, size_t page_size);
+
+  const Options options_;
+
+  std::mutex mutex_;
+  std::vector<Block> blocks_;
+  // The block and the offset in it where the next allocation is bumped.
+  size_t block_index_ = 0;
+  size_t offset_ = 0;
+  size_t num_live_allocations_ = 0;
+  AllocatorStats stats_;
+};
+
+// Installs |arena| as |HugePageArena::GetCurrent()| on the current thread for
+// the lifetime of this object, restoring the previous one afterwards. Other
+// threads, including the workers of a parallel loop, don't see it, so a
+// worker that allocates scratch buffers must be handed the arena explicitly,
+// e.g., through |HugePageArenaAllocator(HugePageArena*)|.
+class TACHYON_EXPORT ScopedHugePageArena {
+ public:
+  explicit ScopedHugePageArena(HugePageArena* arena);
+  ScopedHugePageArena(const ScopedHugePageArena& other) = delete;
+  ScopedHugePageArena& operator=(const ScopedHugePageArena& other) = delete;
+  ~ScopedHugePageArena();
+
+ private:
+  HugePageArena* const arena_;
+  HugePageArena* const previous_;
+};
+
+// An allocator for STL containers that allocates from the given
+// |HugePageArena|, by default the one current on the constructing thread, or
+// from the default heap if there is none. A container must be destroyed
+// before the arena it allocates from.
+//
+//   HugePageArena arena(HugePageArena::Options{});
+//   ScopedHugePageArena scoped_arena(&arena);
+//   std::vector<F, HugePageArenaAllocator<F>> scratch(n);
+template <typename T>
+class HugePageArenaAllocator {
+ public:
+  using value_type = T;
+
+  HugePageArenaAllocator() : arena_(HugePageArena::GetCurrent()) {}
+  explicit HugePageArenaAllocator(HugePageArena* arena) : arena_(arena) {}
+  template <typename U>
+  HugePageArenaAllocator(  // NOLINT(runtime/explicit)
+      const HugePageArenaAllocator<U>& other)
+      : arena_(other.arena_) {}
+
+  HugePageArena* arena() const { return arena_; }
+
+  T* allocate(size_t n) {
+    if (arena_ == nullptr) return std::allocator<T>().allocate(n);
+    return static_cast<T*>(arena_->AllocateRaw(
+        std::max(alignof(T), Allocator::kAllocatorAlignment), n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    if (arena_ == nullptr) return std::allocator<T>().deallocate(ptr, n);
+    arena_->DeallocateRaw(ptr);
+  }
+
+  template <typename U>
+  bool operator==(const HugePageArenaAllocator<U>& other) const {
+    return arena_ == other.arena_;
+  }
+  template <typename U>
+  bool operator!=(const HugePageArenaAllocator<U>& other) const {
+    return arena_ != other.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class HugePageArenaAllocator;
+
+  HugePageArena* arena_;
+};
+
+}  // namespace tachyon::device
+
+#endif  // TACHYON_DEVICE_HUGE_PAGE_ARENA_H_
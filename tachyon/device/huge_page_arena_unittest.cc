@@ -0,0 +1,118 @@
+#include "tachyon/device/huge_page_arena.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::device {
+
+namespace {
+
+HugePageArena::Options CreateSmallOptions() {
+  HugePageArena::Options options;
+  options.page_size = HugePageArena::PageSize::kDefault;
+  options.block_size = size_t{1} << 21;
+  options.first_touch_threshold = size_t{1} << 12;
+  return options;
+}
+
+}  // namespace
+
+TEST(HugePageArenaTest, AllocateRaw) {
+  HugePageArena arena(CreateSmallOptions());
+  void* a = arena.AllocateRaw(64, 100);
+  void* b = arena.AllocateRaw(64, size_t{1} << 16);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0);
+  EXPECT_GE(static_cast<uint8_t*>(b), static_cast<uint8_t*>(a) + 100);
+
+  // An allocation larger than a block gets a block of its own.
+  void* c = arena.AllocateRaw(64, size_t{3} << 20);
+  ASSERT_NE(c, nullptr);
+  static_cast<uint8_t*>(c)[(size_t{3} << 20) - 1] = 1;
+
+  std::optional<AllocatorStats> stats = arena.GetStats();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(stats->num_allocs, 3);
+  EXPECT_EQ(stats->bytes_in_use, 100 + (int64_t{1} << 16) + (int64_t{3} << 20));
+  EXPECT_EQ(stats->largest_alloc_size, int64_t{3} << 20);
+  EXPECT_GE(stats->bytes_reserved, (int64_t{1} << 21) + (int64_t{3} << 20));
+
+  arena.DeallocateRaw(a);
+  arena.DeallocateRaw(b);
+  arena.DeallocateRaw(c);
+}
+
+TEST(HugePageArenaTest, Rewind) {
+  HugePageArena arena(CreateSmallOptions());
+  void* a = arena.AllocateRaw(64, 100);
+  void* b = arena.AllocateRaw(64, 100);
+  arena.DeallocateRaw(a);
+  // |b| is still alive, so the arena doesn't rewind.
+  void* c = arena.AllocateRaw(64, 100);
+  EXPECT_NE(c, a);
+  arena.DeallocateRaw(b);
+  arena.DeallocateRaw(c);
+
+  // Every allocation is deallocated, so the pages are reused.
+  void* d = arena.AllocateRaw(64, 100);
+  EXPECT_EQ(d, a);
+  arena.DeallocateRaw(d);
+
+  std::optional<AllocatorStats> stats = arena.GetStats();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(stats->bytes_in_use, 0);
+  EXPECT_EQ(stats->bytes_reserved, int64_t{1} << 21);
+}
+
+TEST(HugePageArenaTest, HugePageArenaAllocator) {
+  std::vector<int, HugePageArenaAllocator<int>> heap_values(10, 1);
+  EXPECT_EQ(heap_values.get_allocator().arena(), nullptr);
+
+  HugePageArena arena(CreateSmallOptions());
+  {
+    ScopedHugePageArena scoped_arena(&arena);
+    EXPECT_EQ(HugePageArena::GetCurrent(), &arena);
+
+    std::vector<int, HugePageArenaAllocator<int>> values(10000, 1);
+    EXPECT_EQ(values.get_allocator().arena(), &arena);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] += static_cast<int>(i);
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(values[i], static_cast<int>(i) + 1);
+    }
+    EXPECT_EQ(arena.GetStats()->num_allocs, 1);
+  }
+  EXPECT_EQ(HugePageArena::GetCurrent(), nullptr);
+  EXPECT_EQ(arena.GetStats()->bytes_in_use, 0);
+}
+
+TEST(HugePageArenaTest, ScopedHugePageArena) {
+  HugePageArena arena(CreateSmallOptions());
+  HugePageArena arena2(CreateSmallOptions());
+  {
+    ScopedHugePageArena scoped_arena(&arena);
+    {
+      ScopedHugePageArena scoped_arena2(&arena2);
+      EXPECT_EQ(HugePageArena::GetCurrent(), &arena2);
+    }
+    EXPECT_EQ(HugePageArena::GetCurrent(), &arena);
+
+    // The arena isn't installed on the other threads.
+    HugePageArena* current = &arena;
+    std::thread thread([&current]() {
+      current = HugePageArena::GetCurrent();
+      std::vector<int, HugePageArenaAllocator<int>> values(10, 1);
+      EXPECT_EQ(values.get_allocator().arena(), nullptr);
+    });
+    thread.join();
+    EXPECT_EQ(current, nullptr);
+  }
+  EXPECT_EQ(HugePageArena::GetCurrent(), nullptr);
+}
+
+}  // namespace tachyon::device
@@ -704,14 +704,19 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
   // in the resulting array.
   std::array<uint8_t, kByteNums> ToBytesLE() const {
     std::array<uint8_t, kByteNums> ret;
-    auto it = ret.begin();
+    ToBytesLE(ret.data());
+    return ret;
+  }
+
+  // Same as above, but writes the bytes to |bytes|, which must have room for
+  // |kByteNums| bytes, instead of returning a temporary array.
+  void ToBytesLE(uint8_t* bytes) const {
     FOR_FROM_SMALLEST(i, 0, kByteNums) {
       size_t limb_idx = i / kLimbByteNums;
       uint64_t limb = limbs[limb_idx];
       size_t byte_r_idx = i % kLimbByteNums;
-      *(it++) = reinterpret_cast<uint8_t*>(&limb)[byte_r_idx];
+      *(bytes++) = reinterpret_cast<uint8_t*>(&limb)[byte_r_idx];
     }
-    return ret;
   }
 
   // Converts the BigInt to a byte array in big-endian order. This method
@@ -719,14 +724,19 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
   // in the resulting array.
   std::array<uint8_t, kByteNums> ToBytesBE() const {
     std::array<uint8_t, kByteNums> ret;
-    auto it = ret.begin();
+    ToBytesBE(ret.data());
+    return ret;
+  }
+
+  // Same as above, but writes the bytes to |bytes|, which must have room for
+  // |kByteNums| bytes, instead of returning a temporary array.
+  void ToBytesBE(uint8_t* bytes) const {
     FOR_FROM_BIGGEST(i, 0, kByteNums) {
       size_t limb_idx = i / kLimbByteNums;
       uint64_t limb = limbs[limb_idx];
       size_t byte_r_idx = i % kLimbByteNums;
-      *(it++) = reinterpret_cast<uint8_t*>(&limb)[byte_r_idx];
+      *(bytes++) = reinterpret_cast<uint8_t*>(&limb)[byte_r_idx];
     }
-    return ret;
   }
 
   template <bool ModulusHasSpareBit>
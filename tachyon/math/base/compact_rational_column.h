@@ -0,0 +1,255 @@
+#ifndef TACHYON_MATH_BASE_COMPACT_RATIONAL_COLUMN_H_
+#define TACHYON_MATH_BASE_COMPACT_RATIONAL_COLUMN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/rational_field.h"
+
+namespace tachyon::math {
+
+// A column of |RationalField<F>|s that stores a denominator only for the
+// cells that have one. Most cells of a witness column are trivial, i.e., their
+// denominators are one, so keeping a |RationalField<F>| per cell doubles the
+// memory and makes |BatchEvaluate()| invert a denominator per cell.
+//
+// |values_[i]| is the numerator of the i-th cell and the denominators of the
+// non-trivial cells are kept in |denominators_| with their rows in |rows_|.
+// While the rows are assigned in order, which is how a witness is usually
+// filled, |rows_| stays sorted and is searched by a binary search. Otherwise,
+// |slots_| is built to find the denominator of a row.
+template <typename F>
+class CompactRationalColumn {
+ public:
+  CompactRationalColumn() = default;
+  explicit CompactRationalColumn(size_t size) : values_(size, F::Zero()) {}
+
+  size_t size() const { return values_.size(); }
+  const std::vector<F>& values() const { return values_; }
+  size_t num_rationals() const { return rows_.size(); }
+
+  RationalField<F> operator[](size_t row) const {
+    size_t slot = FindSlot(row);
+    if (slot == kNoSlot) return RationalField<F>(values_[row]);
+    return RationalField<F>(values_[row], denominators_[slot]);
+  }
+
+  bool operator==(const CompactRationalColumn& other) const {
+    if (size() != other.size()) return false;
+    std::vector<F> denominators = GetDenominators();
+    std::vector<F> other_denominators = other.GetDenominators();
+    for (size_t i = 0; i < size(); ++i) {
+      if (RationalField<F>(values_[i], denominators[i]) !=
+          RationalField<F>(other.values_[i], other_denominators[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+  bool operator!=(const CompactRationalColumn& other) const {
+    return !operator==(other);
+  }
+
+  void SetZero(size_t row) { SetTrivial(row, F::Zero()); }
+
+  void SetTrivial(size_t row, const F& numerator) {
+    RemoveDenominator(row);
+    values_[row] = numerator;
+  }
+
+  void SetRational(size_t row, const F& numerator, const F& denominator) {
+    values_[row] = numerator;
+    if (IsPastLastRow(row)) {
+      AppendDenominator(row, denominator);
+      return;
+    }
+    BuildSlots();
+    uint32_t slot = slots_[row];
+    if (slot == kNoSlot) {
+      sorted_ = false;
+      AppendDenominator(row, denominator);
+    } else {
+      denominators_[slot] = denominator;
+    }
+  }
+
+  // Sets the cells in [|offset|, |offset| + |size|) to zero.
+  void SetZeros(size_t offset, size_t size) {
+    CHECK_LE(offset + size, values_.size());
+    RemoveDenominators(offset, size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      values_[offset + i] = F::Zero();
+    }
+  }
+
+  // Sets the cells from |offset| to |numerators|.
+  void SetTrivials(size_t offset, absl::Span<const F> numerators) {
+    CHECK_LE(offset + numerators.size(), values_.size());
+    RemoveDenominators(offset, numerators.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < numerators.size(); ++i) {
+      values_[offset + i] = numerators[i];
+    }
+  }
+
+  // Sets the cells from |offset| to |numerators| / |denominators|.
+  void SetRationals(size_t offset, absl::Span<const F> numerators,
+                    absl::Span<const F> denominators) {
+    CHECK_EQ(numerators.size(), denominators.size());
+    size_t size = numerators.size();
+    CHECK_LE(offset + size, values_.size());
+    if (size == 0) return;
+    // NOTE: The denominators in the range are dropped first, so that the
+    // cells are appended in bulk.
+    RemoveDenominators(offset, size);
+    if (!IsPastLastRow(offset)) sorted_ = false;
+
+    size_t old_size = rows_.size();
+    CHECK_LE(old_size + size, size_t{kNoSlot});
+    rows_.resize(old_size + size);
+    denominators_.insert(denominators_.end(), denominators.begin(),
+                         denominators.end());
+    bool has_slots = !slots_.empty();
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      values_[offset + i] = numerators[i];
+      rows_[old_size + i] = offset + i;
+      if (has_slots) slots_[offset + i] = static_cast<uint32_t>(old_size + i);
+    }
+  }
+
+  // Evaluates every cell into |results|, inverting only the denominators of
+  // the non-trivial cells.
+  [[nodiscard]] bool BatchEvaluate(std::vector<F>* results) const {
+    std::vector<F> inverses = denominators_;
+    if (!F::BatchInverseInPlace(inverses)) return false;
+    *results = values_;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < rows_.size(); ++i) {
+      (*results)[rows_[i]] *= inverses[i];
+    }
+    return true;
+  }
+
+ private:
+  constexpr static uint32_t kNoSlot = std::numeric_limits<uint32_t>::max();
+
+  // Returns true if |row| comes after every row that has a denominator, in
+  // which case a denominator for |row| keeps |rows_| sorted.
+  bool IsPastLastRow(size_t row) const {
+    return rows_.empty() || (sorted_ && rows_.back() < row);
+  }
+
+  // Returns the index of the denominator of |row| or |kNoSlot| if the cell is
+  // trivial.
+  size_t FindSlot(size_t row) const {
+    if (IsPastLastRow(row)) return kNoSlot;
+    if (!slots_.empty()) return slots_[row];
+    if (sorted_) {
+      auto it = std::lower_bound(rows_.begin(), rows_.end(), row);
+      if (it == rows_.end() || *it != row) return kNoSlot;
+      return it - rows_.begin();
+    }
+    auto it = std::find(rows_.begin(), rows_.end(), row);
+    if (it == rows_.end()) return kNoSlot;
+    return it - rows_.begin();
+  }
+
+  // Returns the denominator of every cell.
+  std::vector<F> GetDenominators() const {
+    std::vector<F> denominators(size(), F::One());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < rows_.size(); ++i) {
+      denominators[rows_[i]] = denominators_[i];
+    }
+    return denominators;
+  }
+
+  void AppendDenominator(size_t row, const F& denominator) {
+    CHECK_LT(rows_.size(), size_t{kNoSlot});
+    if (!slots_.empty()) slots_[row] = static_cast<uint32_t>(rows_.size());
+    rows_.push_back(row);
+    denominators_.push_back(denominator);
+  }
+
+  // Builds |slots_| once the rows are assigned out of order.
+  void BuildSlots() {
+    if (!slots_.empty()) return;
+    slots_.resize(values_.size(), kNoSlot);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < rows_.size(); ++i) {
+      slots_[rows_[i]] = static_cast<uint32_t>(i);
+    }
+  }
+
+  void RemoveDenominator(size_t row) {
+    if (IsPastLastRow(row)) return;
+    if (sorted_ && rows_.back() == row) {
+      if (!slots_.empty()) slots_[row] = kNoSlot;
+      rows_.pop_back();
+      denominators_.pop_back();
+      return;
+    }
+    BuildSlots();
+    uint32_t slot = slots_[row];
+    if (slot == kNoSlot) return;
+    slots_[row] = kNoSlot;
+    size_t last = rows_.size() - 1;
+    if (slot != last) {
+      sorted_ = false;
+      rows_[slot] = rows_[last];
+      denominators_[slot] = std::move(denominators_[last]);
+      slots_[rows_[slot]] = slot;
+    }
+    rows_.pop_back();
+    denominators_.pop_back();
+  }
+
+  // Removes the denominators of the rows in [|offset|, |offset| + |size|) in a
+  // single pass over |rows_|, keeping the order of the others.
+  void RemoveDenominators(size_t offset, size_t size) {
+    if (size == 0 || IsPastLastRow(offset)) return;
+    size_t begin = 0;
+    size_t end = rows_.size();
+    if (sorted_) {
+      begin = std::lower_bound(rows_.begin(), rows_.end(), offset) -
+              rows_.begin();
+      end = std::lower_bound(rows_.begin() + begin, rows_.end(),
+                             offset + size) -
+            rows_.begin();
+    }
+    size_t kept = begin;
+    for (size_t i = begin; i < rows_.size(); ++i) {
+      size_t row = rows_[i];
+      if (i < end && offset <= row && row < offset + size) {
+        if (!slots_.empty()) slots_[row] = kNoSlot;
+        continue;
+      }
+      if (kept != i) {
+        rows_[kept] = row;
+        denominators_[kept] = std::move(denominators_[i]);
+        if (!slots_.empty()) slots_[row] = static_cast<uint32_t>(kept);
+      }
+      ++kept;
+    }
+    rows_.resize(kept);
+    denominators_.resize(kept);
+  }
+
+  std::vector<F> values_;
+  std::vector<F> denominators_;
+  std::vector<size_t> rows_;
+  // Whether |rows_| is sorted in ascending order.
+  bool sorted_ = true;
+  // row -> index in |denominators_| and |rows_| or |kNoSlot|. This is empty
+  // until a row is assigned out of order.
+  std::vector<uint32_t> slots_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_BASE_COMPACT_RATIONAL_COLUMN_H_
@@ -0,0 +1,183 @@
+#include "tachyon/math/base/compact_rational_column.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using R = RationalField<GF7>;
+
+class CompactRationalColumnTest : public FiniteFieldTest<GF7> {};
+
+GF7 RandomNonZero() {
+  GF7 ret = GF7::Random();
+  while (ret.IsZero()) {
+    ret = GF7::Random();
+  }
+  return ret;
+}
+
+}  // namespace
+
+TEST_F(CompactRationalColumnTest, Setters) {
+  CompactRationalColumn<GF7> column(4);
+  EXPECT_EQ(column.size(), size_t{4});
+  for (size_t i = 0; i < column.size(); ++i) {
+    EXPECT_TRUE(column[i].IsZero());
+  }
+
+  column.SetTrivial(0, GF7(3));
+  column.SetRational(1, GF7(2), GF7(5));
+  column.SetRational(2, GF7(4), GF7(6));
+  EXPECT_EQ(column[0], R(GF7(3)));
+  EXPECT_EQ(column[1], R(GF7(2), GF7(5)));
+  EXPECT_EQ(column[2], R(GF7(4), GF7(6)));
+  EXPECT_EQ(column.num_rationals(), size_t{2});
+
+  // Overwriting a rational cell drops its denominator.
+  column.SetTrivial(1, GF7(1));
+  EXPECT_EQ(column[1], R(GF7(1)));
+  EXPECT_EQ(column[2], R(GF7(4), GF7(6)));
+  EXPECT_EQ(column.num_rationals(), size_t{1});
+
+  column.SetZero(2);
+  EXPECT_TRUE(column[2].IsZero());
+  EXPECT_EQ(column.num_rationals(), size_t{0});
+}
+
+TEST_F(CompactRationalColumnTest, BulkSetters) {
+  CompactRationalColumn<GF7> column(6);
+  std::vector<GF7> numerators = {GF7(1), GF7(2), GF7(3)};
+  std::vector<GF7> denominators = {GF7(4), GF7(5), GF7(6)};
+
+  column.SetRationals(0, numerators, denominators);
+  column.SetTrivials(2, numerators);
+  EXPECT_EQ(column[0], R(GF7(1), GF7(4)));
+  EXPECT_EQ(column[1], R(GF7(2), GF7(5)));
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(column[2 + i], R(numerators[i]));
+  }
+  EXPECT_EQ(column.num_rationals(), size_t{2});
+
+  column.SetZeros(0, 3);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_TRUE(column[i].IsZero());
+  }
+  EXPECT_EQ(column.num_rationals(), size_t{0});
+}
+
+TEST_F(CompactRationalColumnTest, SettersOutOfOrder) {
+  CompactRationalColumn<GF7> column(6);
+  column.SetRational(4, GF7(1), GF7(2));
+  column.SetRational(1, GF7(3), GF7(4));
+  column.SetRational(3, GF7(5), GF7(6));
+  column.SetRational(1, GF7(2), GF7(3));
+  EXPECT_EQ(column[1], R(GF7(2), GF7(3)));
+  EXPECT_EQ(column[3], R(GF7(5), GF7(6)));
+  EXPECT_EQ(column[4], R(GF7(1), GF7(2)));
+  EXPECT_EQ(column.num_rationals(), size_t{3});
+
+  column.SetTrivial(1, GF7(5));
+  EXPECT_EQ(column[1], R(GF7(5)));
+  EXPECT_EQ(column[3], R(GF7(5), GF7(6)));
+  EXPECT_EQ(column[4], R(GF7(1), GF7(2)));
+  EXPECT_EQ(column.num_rationals(), size_t{2});
+
+  std::vector<GF7> numerators = {GF7(1), GF7(2), GF7(3)};
+  std::vector<GF7> denominators = {GF7(4), GF7(5), GF7(6)};
+  column.SetRationals(2, numerators, denominators);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(column[2 + i], R(numerators[i], denominators[i]));
+  }
+  EXPECT_EQ(column.num_rationals(), size_t{3});
+
+  column.SetTrivials(3, numerators);
+  EXPECT_EQ(column[2], R(GF7(1), GF7(4)));
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(column[3 + i], R(numerators[i]));
+  }
+  EXPECT_EQ(column.num_rationals(), size_t{1});
+}
+
+TEST_F(CompactRationalColumnTest, RandomAssignments) {
+  constexpr size_t kSize = 32;
+
+  CompactRationalColumn<GF7> column(kSize);
+  std::vector<R> expected(kSize, R(GF7::Zero()));
+  for (size_t i = 0; i < 200; ++i) {
+    size_t offset = base::Uniform(base::Range<size_t>(0, kSize));
+    size_t size = base::Uniform(base::Range<size_t>(0, kSize - offset + 1));
+    std::vector<GF7> numerators =
+        base::CreateVector(size, []() { return GF7::Random(); });
+    std::vector<GF7> denominators =
+        base::CreateVector(size, []() { return RandomNonZero(); });
+    switch (base::Uniform(base::Range<int>(0, 6))) {
+      case 0:
+        column.SetZero(offset);
+        expected[offset] = R(GF7::Zero());
+        break;
+      case 1:
+        column.SetTrivial(offset, GF7(3));
+        expected[offset] = R(GF7(3));
+        break;
+      case 2:
+        column.SetRational(offset, GF7(2), GF7(5));
+        expected[offset] = R(GF7(2), GF7(5));
+        break;
+      case 3:
+        column.SetZeros(offset, size);
+        for (size_t j = 0; j < size; ++j) {
+          expected[offset + j] = R(GF7::Zero());
+        }
+        break;
+      case 4:
+        column.SetTrivials(offset, numerators);
+        for (size_t j = 0; j < size; ++j) {
+          expected[offset + j] = R(numerators[j]);
+        }
+        break;
+      case 5:
+        column.SetRationals(offset, numerators, denominators);
+        for (size_t j = 0; j < size; ++j) {
+          expected[offset + j] = R(numerators[j], denominators[j]);
+        }
+        break;
+    }
+    for (size_t j = 0; j < kSize; ++j) {
+      ASSERT_EQ(column[j], expected[j]);
+    }
+  }
+}
+
+TEST_F(CompactRationalColumnTest, BatchEvaluate) {
+  constexpr size_t kSize = 20;
+
+  CompactRationalColumn<GF7> column(kSize);
+  std::vector<R> expected_rationals(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    if (i % 3 == 0) {
+      expected_rationals[i] = R(GF7::Random(), RandomNonZero());
+      column.SetRational(i, expected_rationals[i].numerator(),
+                         expected_rationals[i].denominator());
+    } else {
+      expected_rationals[i] = R(GF7::Random());
+      column.SetTrivial(i, expected_rationals[i].numerator());
+    }
+  }
+
+  std::vector<GF7> expected(kSize);
+  ASSERT_TRUE(R::BatchEvaluate(expected_rationals, &expected));
+  std::vector<GF7> actual;
+  ASSERT_TRUE(column.BatchEvaluate(&actual));
+  EXPECT_EQ(actual, expected);
+}
+
+}  // namespace tachyon::math
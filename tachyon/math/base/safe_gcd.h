@@ -0,0 +1,337 @@
+#ifndef TACHYON_MATH_BASE_SAFE_GCD_H_
+#define TACHYON_MATH_BASE_SAFE_GCD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <optional>
+#include <utility>
+
+#include "absl/numeric/int128.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// Modular inversion and Jacobi symbol by the divstep-based gcd of Bernstein
+// and Yang, with the batching of libsecp256k1.
+//
+// The divsteps only look at the lowest bits of their operands, so 62 of them
+// are run on 64-bit words at a time and accumulated into a 2x2 transition
+// matrix, which is then applied to the full numbers at once. The full numbers
+// are represented with signed 62-bit limbs so that the matrix multiplications
+// never overflow.
+//
+// See https://gcd.cr.yp.to/safegcd-20190413.pdf and
+// https://github.com/bitcoin-core/secp256k1/blob/master/doc/safegcd_implementation.md
+//
+// NOTE: Both |Inverse()| and |Jacobi()| run in variable time, like the binary
+// extended Euclidean algorithm of |BigInt::MontgomeryInverse()|.
+template <size_t N>
+class SafeGcd {
+ public:
+  // The number of signed 62-bit limbs, which leaves room for a sign and the
+  // intermediate values in (-2 * modulus, modulus).
+  constexpr static size_t kLimbNums = N * 64 / 62 + 1;
+  // The number of batches of posdivsteps |Jacobi()| runs before it gives up.
+  // More than 6 posdivsteps per bit are extremely rare.
+  constexpr static size_t kMaxJacobiIterations = N * 64 * 6 / 62 + 1;
+
+  // |modulus| must be odd and |modulus_inverse62| is modulus⁻¹ mod 2⁶².
+  constexpr SafeGcd(const BigInt<N>& modulus, uint64_t modulus_inverse62)
+      : modulus_(ToSigned62(modulus)),
+        modulus_inverse62_(modulus_inverse62) {}
+
+  // Returns |x|⁻¹ mod modulus. |x| must be in [1, modulus) and coprime to
+  // the modulus.
+  BigInt<N> Inverse(const BigInt<N>& x) const {
+    CHECK(!x.IsZero());
+    // The invariants are d * x = f and e * x = g (mod modulus).
+    Signed62 d = {};
+    Signed62 e = {};
+    e[0] = 1;
+    Signed62 f = modulus_;
+    Signed62 g = ToSigned62(x);
+    // eta = -delta, where delta starts at 1.
+    int64_t eta = -1;
+    while (true) {
+      Transition t;
+      eta = DivSteps62(eta, LowBits(f), LowBits(g), &t);
+      UpdateDE(t, &d, &e);
+      UpdateFG(t, &f, &g);
+      if (IsZero(g)) break;
+    }
+    // Now f = ±gcd(modulus, x) = ±1 and d * x = f.
+    DCHECK(f[kLimbNums - 1] == 0 || f[kLimbNums - 1] == -1);
+    return FromSigned62(Normalize(d, f[kLimbNums - 1] < 0));
+  }
+
+  // Returns the Jacobi symbol (|x| / modulus), which is the Legendre symbol
+  // if the modulus is a prime. |x| must be in [1, modulus). Returns
+  // std::nullopt if it doesn't converge in |kMaxJacobiIterations| batches,
+  // in which case the caller should fall back to another method.
+  std::optional<int> Jacobi(const BigInt<N>& x) const {
+    DCHECK(!x.IsZero());
+    Signed62 f = modulus_;
+    Signed62 g = ToSigned62(x);
+    int64_t eta = -1;
+    // The lowest bit is set if the symbol has flipped its sign.
+    uint64_t jacobi = 0;
+    for (size_t i = 0; i < kMaxJacobiIterations; ++i) {
+      Transition t;
+      eta = PosDivSteps62(eta, LowBits(f), LowBits(g), &t, &jacobi);
+      UpdateFG(t, &f, &g);
+      if (IsOne(f)) {
+        // (g / 1) = 1.
+        return (jacobi & 1) ? -1 : 1;
+      }
+    }
+    return std::nullopt;
+  }
+
+ private:
+  using Signed62 = std::array<int64_t, kLimbNums>;
+
+  constexpr static uint64_t kMask62 = (uint64_t{1} << 62) - 1;
+
+  // The transition matrix of 62 divsteps, scaled by 2⁶² so that its entries
+  // are integers.
+  struct Transition {
+    int64_t u;
+    int64_t v;
+    int64_t q;
+    int64_t r;
+  };
+
+  constexpr static Signed62 ToSigned62(const BigInt<N>& value) {
+    Signed62 ret = {};
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      size_t bit = 62 * i;
+      size_t limb = bit / 64;
+      size_t shift = bit % 64;
+      if (limb >= N) break;
+      uint64_t bits = value[limb] >> shift;
+      // NOTE: A limb that starts at bit 0, 1 or 2 of a 64-bit limb fits in it.
+      if (shift > 2 && limb + 1 < N) {
+        bits |= value[limb + 1] << (64 - shift);
+      }
+      ret[i] = static_cast<int64_t>(bits & kMask62);
+    }
+    return ret;
+  }
+
+  // |value| must be in [0, modulus) with its limbs normalized.
+  static BigInt<N> FromSigned62(const Signed62& value) {
+    BigInt<N> ret;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      size_t bit = 62 * i;
+      size_t limb = bit / 64;
+      size_t shift = bit % 64;
+      if (limb >= N) break;
+      uint64_t bits = static_cast<uint64_t>(value[i]);
+      ret[limb] |= bits << shift;
+      if (shift > 2 && limb + 1 < N) {
+        ret[limb + 1] |= bits >> (64 - shift);
+      }
+    }
+    return ret;
+  }
+
+  // Returns the lowest 64 bits of |value|.
+  static uint64_t LowBits(const Signed62& value) {
+    return static_cast<uint64_t>(value[0]) |
+           (static_cast<uint64_t>(value[1]) << 62);
+  }
+
+  static bool IsZero(const Signed62& value) {
+    int64_t bits = 0;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      bits |= value[i];
+    }
+    return bits == 0;
+  }
+
+  static bool IsOne(const Signed62& value) {
+    if (value[0] != 1) return false;
+    int64_t bits = 0;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      bits |= value[i];
+    }
+    return bits == 0;
+  }
+
+  // Runs 62 divsteps on the lowest 64 bits of f and g, starting from |eta|,
+  // and returns the new eta.
+  static int64_t DivSteps62(int64_t eta, uint64_t f, uint64_t g,
+                            Transition* t) {
+    // NOTE: The entries are computed mod 2⁶⁴, so that shifting negative ones
+    // to the left is well defined. They are in [-2⁶², 2⁶²] in the end.
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    int i = 62;
+    while (true) {
+      // Every zero at the bottom of g is a divstep that halves g. The
+      // sentinel bit stops at the remaining number of divsteps.
+      int zeros = base::bits::CountTrailingZeroBits(g | (~uint64_t{0} << i));
+      g >>= zeros;
+      u <<= zeros;
+      v <<= zeros;
+      eta -= zeros;
+      i -= zeros;
+      if (i == 0) break;
+      // g is odd here. If eta is negative, (eta, f, g) becomes (-eta, g, -f).
+      if (eta < 0) {
+        eta = -eta;
+        std::swap(f, g);
+        g = -g;
+        std::swap(u, q);
+        q = -q;
+        std::swap(v, r);
+        r = -r;
+      }
+      // Makes g even, which is halved in the next iteration.
+      g += f;
+      q += u;
+      r += v;
+    }
+    *t = {static_cast<int64_t>(u), static_cast<int64_t>(v),
+          static_cast<int64_t>(q), static_cast<int64_t>(r)};
+    return eta;
+  }
+
+  // Same as |DivSteps62()|, but keeps f and g positive by swapping them
+  // without negation, and tracks the sign of the Jacobi symbol (g / f) in the
+  // lowest bit of |jacobi|.
+  static int64_t PosDivSteps62(int64_t eta, uint64_t f, uint64_t g,
+                               Transition* t, uint64_t* jacobi) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    uint64_t jac = *jacobi;
+    int i = 62;
+    while (true) {
+      int zeros = base::bits::CountTrailingZeroBits(g | (~uint64_t{0} << i));
+      g >>= zeros;
+      u <<= zeros;
+      v <<= zeros;
+      eta -= zeros;
+      i -= zeros;
+      // (2 / f) = -1 if f = 3 or 5 (mod 8).
+      jac ^= zeros & ((f >> 1) ^ (f >> 2));
+      if (i == 0) break;
+      if (eta < 0) {
+        eta = -eta;
+        std::swap(f, g);
+        std::swap(u, q);
+        std::swap(v, r);
+        // (g / f) = -(f / g) if f = g = 3 (mod 4).
+        jac ^= (f & g) >> 1;
+      }
+      // (g + f / f) = (g / f).
+      g += f;
+      q += u;
+      r += v;
+    }
+    *t = {static_cast<int64_t>(u), static_cast<int64_t>(v),
+          static_cast<int64_t>(q), static_cast<int64_t>(r)};
+    *jacobi = jac;
+    return eta;
+  }
+
+  // Computes (f, g) = t * (f, g) / 2⁶², which is exact.
+  static void UpdateFG(const Transition& t, Signed62* f, Signed62* g) {
+    Signed62& fr = *f;
+    Signed62& gr = *g;
+    absl::int128 cf = absl::int128(t.u) * fr[0] + absl::int128(t.v) * gr[0];
+    absl::int128 cg = absl::int128(t.q) * fr[0] + absl::int128(t.r) * gr[0];
+    DCHECK_EQ(absl::Int128Low64(cf) & kMask62, uint64_t{0});
+    DCHECK_EQ(absl::Int128Low64(cg) & kMask62, uint64_t{0});
+    cf >>= 62;
+    cg >>= 62;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      cf += absl::int128(t.u) * fr[i] + absl::int128(t.v) * gr[i];
+      cg += absl::int128(t.q) * fr[i] + absl::int128(t.r) * gr[i];
+      fr[i - 1] = static_cast<int64_t>(absl::Int128Low64(cf) & kMask62);
+      gr[i - 1] = static_cast<int64_t>(absl::Int128Low64(cg) & kMask62);
+      cf >>= 62;
+      cg >>= 62;
+    }
+    fr[kLimbNums - 1] = static_cast<int64_t>(cf);
+    gr[kLimbNums - 1] = static_cast<int64_t>(cg);
+  }
+
+  // Computes (d, e) = t * (d, e) / 2⁶² (mod modulus), adding the multiples of
+  // the modulus that clear the lowest 62 bits before the division. d and e
+  // stay in (-2 * modulus, modulus).
+  void UpdateDE(const Transition& t, Signed62* d, Signed62* e) const {
+    Signed62& dr = *d;
+    Signed62& er = *e;
+    // md and me start with the multiples that make the negative inputs
+    // positive.
+    int64_t sd = dr[kLimbNums - 1] >> 63;
+    int64_t se = er[kLimbNums - 1] >> 63;
+    int64_t md = (t.u & sd) + (t.v & se);
+    int64_t me = (t.q & sd) + (t.r & se);
+    absl::int128 cd = absl::int128(t.u) * dr[0] + absl::int128(t.v) * er[0];
+    absl::int128 ce = absl::int128(t.q) * dr[0] + absl::int128(t.r) * er[0];
+    md -= static_cast<int64_t>(
+        (modulus_inverse62_ * absl::Int128Low64(cd) + md) & kMask62);
+    me -= static_cast<int64_t>(
+        (modulus_inverse62_ * absl::Int128Low64(ce) + me) & kMask62);
+    cd += absl::int128(modulus_[0]) * md;
+    ce += absl::int128(modulus_[0]) * me;
+    DCHECK_EQ(absl::Int128Low64(cd) & kMask62, uint64_t{0});
+    DCHECK_EQ(absl::Int128Low64(ce) & kMask62, uint64_t{0});
+    cd >>= 62;
+    ce >>= 62;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      cd += absl::int128(t.u) * dr[i] + absl::int128(t.v) * er[i] +
+            absl::int128(modulus_[i]) * md;
+      ce += absl::int128(t.q) * dr[i] + absl::int128(t.r) * er[i] +
+            absl::int128(modulus_[i]) * me;
+      dr[i - 1] = static_cast<int64_t>(absl::Int128Low64(cd) & kMask62);
+      er[i - 1] = static_cast<int64_t>(absl::Int128Low64(ce) & kMask62);
+      cd >>= 62;
+      ce >>= 62;
+    }
+    dr[kLimbNums - 1] = static_cast<int64_t>(cd);
+    er[kLimbNums - 1] = static_cast<int64_t>(ce);
+  }
+
+  // Propagates the carries so that every limb but the top one is in
+  // [0, 2⁶²).
+  static void PropagateCarries(Signed62& value) {
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      value[i + 1] += value[i] >> 62;
+      value[i] &= static_cast<int64_t>(kMask62);
+    }
+  }
+
+  void AddModulus(Signed62& value) const {
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      value[i] += modulus_[i];
+    }
+    PropagateCarries(value);
+  }
+
+  // Maps |value| in (-2 * modulus, modulus) to ±|value| mod modulus in
+  // [0, modulus).
+  const Signed62& Normalize(Signed62& value, bool negate) const {
+    if (value[kLimbNums - 1] < 0) AddModulus(value);
+    if (negate) {
+      for (size_t i = 0; i < kLimbNums; ++i) {
+        value[i] = -value[i];
+      }
+      PropagateCarries(value);
+    }
+    if (value[kLimbNums - 1] < 0) AddModulus(value);
+    return value;
+  }
+
+  Signed62 modulus_;
+  uint64_t modulus_inverse62_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_BASE_SAFE_GCD_H_
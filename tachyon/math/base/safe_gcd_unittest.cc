@@ -0,0 +1,79 @@
+#include "tachyon/math/base/safe_gcd.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/base/gmp/gmp_util.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <size_t N>
+SafeGcd<N> CreateSafeGcd(const BigInt<N>& modulus) {
+  // Newton's iteration doubles the number of correct bits of the inverse.
+  uint64_t inverse = 1;
+  for (size_t i = 0; i < 6; ++i) {
+    inverse *= 2 - modulus[0] * inverse;
+  }
+  return SafeGcd<N>(modulus, inverse & ((uint64_t{1} << 62) - 1));
+}
+
+template <size_t N>
+mpz_class ToMpz(const BigInt<N>& value) {
+  mpz_class ret;
+  gmp::WriteLimbs(value.limbs, N, &ret);
+  return ret;
+}
+
+template <size_t N>
+void TestSafeGcd(const BigInt<N>& modulus) {
+  SafeGcd<N> safe_gcd = CreateSafeGcd(modulus);
+  mpz_class m = ToMpz(modulus);
+  BigInt<N> modulus_minus_one = modulus;
+  modulus_minus_one -= BigInt<N>::One();
+
+  std::vector<BigInt<N>> inputs = {BigInt<N>::One(), BigInt<N>(2),
+                                   modulus_minus_one};
+  for (size_t i = 0; i < 100; ++i) {
+    BigInt<N> x = BigInt<N>::Random(modulus);
+    if (x.IsZero()) continue;
+    inputs.push_back(x);
+  }
+  for (const BigInt<N>& x : inputs) {
+    mpz_class expected;
+    mpz_invert(expected.get_mpz_t(), ToMpz(x).get_mpz_t(), m.get_mpz_t());
+    EXPECT_EQ(ToMpz(safe_gcd.Inverse(x)), expected);
+
+    std::optional<int> jacobi = safe_gcd.Jacobi(x);
+    ASSERT_TRUE(jacobi.has_value());
+    EXPECT_EQ(*jacobi, mpz_jacobi(ToMpz(x).get_mpz_t(), m.get_mpz_t()));
+  }
+}
+
+}  // namespace
+
+TEST(SafeGcdTest, Bn254) {
+  TestSafeGcd(BigInt<4>::FromDecString(
+      "2188824287183927522224640574525727508869631115729782366268903789464522"
+      "6208583"));
+}
+
+TEST(SafeGcdTest, Secp256k1) {
+  // NOTE: This modulus has no spare bit.
+  TestSafeGcd(BigInt<4>::FromHexString(
+      "fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f"));
+}
+
+TEST(SafeGcdTest, Bls12_381) {
+  TestSafeGcd(BigInt<6>::FromHexString(
+      "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffe"
+      "b153ffffb9feffffffffaaab"));
+}
+
+TEST(SafeGcdTest, SmallModulus) {
+  TestSafeGcd(BigInt<1>(uint64_t{0xffffffff00000001}));
+}
+
+}  // namespace tachyon::math
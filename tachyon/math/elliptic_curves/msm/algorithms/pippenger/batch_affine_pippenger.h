@@ -0,0 +1,308 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_PIPPENGER_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_PIPPENGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+
+namespace tachyon::math {
+
+// Pippenger over affine bases whose buckets are kept in affine coordinates.
+// The additions into the buckets of a window are scheduled in batches so that
+// a batch shares a single inversion by Montgomery's trick, which makes an
+// addition cost about 6 multiplications instead of 10 for a mixed addition
+// into an XYZZ bucket. See
+// https://github.com/supranational/sppark/blob/main/msm/batch_addition.cuh.
+//
+// The trick pays off most for G2, where the base field is Fp2: an
+// Fp2 inversion is an Fp inversion plus a few multiplications, so it is
+// relatively cheaper than in Fp and is amortized by smaller batches.
+// |ComputeWindowBits()| picks the window size with a cost model in which
+// these costs are counted in multiplications of the base field.
+template <typename Point>
+class BatchAffinePippenger : public PippengerBase<Point> {
+ public:
+  using BaseField = typename Point::BaseField;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename PippengerBase<Point>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+
+  // The maximum number of additions sharing an inversion.
+  constexpr static size_t kMaxBatchSize = 1024;
+
+  // The cost of an addition into an affine bucket, which is 3
+  // multiplications for λ and the new point and 3 for the batch inversion.
+  constexpr static size_t kBatchAffineAddCost = 6;
+  // The cost of a bucket in |PippengerBase::AccumulateBuckets()|: a mixed
+  // addition (8M + 2S) and an XYZZ addition (12M + 2S).
+  constexpr static size_t kBucketAccumulationCost = 24;
+
+  // The cost of an inversion in multiplications of |BaseField|. An inversion
+  // of a prime field is assumed to cost 100 multiplications. An Fp2 inversion
+  // is an Fp inversion and 4 Fp multiplications, and an Fp2 multiplication
+  // costs 3 Fp multiplications by Karatsuba.
+  constexpr static size_t GetInversionCost() {
+    if constexpr (BaseField::ExtensionDegree() == 1) {
+      return 100;
+    } else {
+      return (100 + 4) / 3;
+    }
+  }
+
+  // Returns the batch size when each window has 2ᵂ⁻¹ buckets, where W is
+  // |window_bits|. A batch can't have two additions into the same bucket, so
+  // it is kept small enough in comparison with the number of buckets that
+  // such conflicts are rare.
+  constexpr static size_t GetBatchSize(unsigned int window_bits) {
+    size_t num_buckets = size_t{1} << (window_bits - 1);
+    return std::clamp(num_buckets / 4, size_t{1}, kMaxBatchSize);
+  }
+
+  // Returns the window bits minimizing ⌈b / W⌉ * (n * A(W) + 2ᵂ⁻¹ * B),
+  // where b is the bit size of |ScalarField|, n is |size|, A(W) is the cost
+  // of a batched affine addition including the amortized inversion and B is
+  // |kBucketAccumulationCost|.
+  constexpr static unsigned int ComputeWindowBits(size_t size) {
+    unsigned int best_window_bits = 2;
+    double best_cost = std::numeric_limits<double>::max();
+    for (unsigned int window_bits = 2; window_bits <= 20; ++window_bits) {
+      double add_cost =
+          kBatchAffineAddCost + static_cast<double>(GetInversionCost()) /
+                                    GetBatchSize(window_bits);
+      double cost =
+          MSMCtx::ComputeWindowsCount<ScalarField>(window_bits) *
+          (size * add_cost +
+           static_cast<double>(size_t{1} << (window_bits - 1)) *
+               kBucketAccumulationCost);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_window_bits = window_bits;
+      }
+    }
+    return best_window_bits;
+  }
+
+  BatchAffinePippenger() {
+#if defined(TACHYON_HAS_OPENMP)
+    parallel_windows_ = true;
+#endif  // defined(TACHYON_HAS_OPENMP)
+  }
+
+  const MSMCtx& ctx() const { return ctx_; }
+
+  void SetParallelWindows(bool parallel_windows) {
+    parallel_windows_ = parallel_windows;
+  }
+
+  template <typename BaseInputIterator, typename ScalarInputIterator,
+            std::enable_if_t<IsAbleToMSM<BaseInputIterator, ScalarInputIterator,
+                                         Point, ScalarField>>* = nullptr>
+  [[nodiscard]] bool Run(BaseInputIterator bases_first,
+                         BaseInputIterator bases_last,
+                         ScalarInputIterator scalars_first,
+                         ScalarInputIterator scalars_last, Bucket* ret) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (bases_size != scalars_size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+    if (scalars_size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+    ctx_ = MSMCtx::CreateWithWindowBits<ScalarField>(
+        scalars_size, ComputeWindowBits(scalars_size));
+
+    std::vector<const Point*> bases(scalars_size);
+    std::vector<std::vector<int64_t>> scalar_digits(scalars_size);
+    auto bases_it = bases_first;
+    auto scalars_it = scalars_first;
+    for (size_t i = 0; i < scalars_size; ++i, ++bases_it, ++scalars_it) {
+      bases[i] = &(*bases_it);
+      scalar_digits[i].resize(ctx_.window_count);
+      FillDigits(scalars_it->ToBigInt(), ctx_.window_bits, &scalar_digits[i]);
+    }
+
+    std::vector<Bucket> window_sums =
+        base::CreateVector(ctx_.window_count, Bucket::Zero());
+    if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+        AccumulateSingleWindowSum(bases, scalar_digits, i, &window_sums[i]);
+      }
+    } else {
+      for (size_t i = 0; i < ctx_.window_count; ++i) {
+        AccumulateSingleWindowSum(bases, scalar_digits, i, &window_sums[i]);
+      }
+    }
+
+    *ret = PippengerBase<Point>::AccumulateWindowSums(
+        absl::MakeConstSpan(window_sums), ctx_.window_bits);
+    return true;
+  }
+
+ private:
+  // An addition of ±|bases[base_index]| into |buckets[bucket_index]|.
+  struct Addition {
+    size_t bucket_index;
+    size_t base_index;
+    bool negative;
+  };
+
+  void AccumulateSingleWindowSum(
+      const std::vector<const Point*>& bases,
+      const std::vector<std::vector<int64_t>>& scalar_digits, size_t window,
+      Bucket* window_sum) const {
+    // The last window may carry one more bit.
+    size_t num_buckets = window == ctx_.window_count - 1
+                             ? size_t{1} << ctx_.window_bits
+                             : size_t{1} << (ctx_.window_bits - 1);
+    std::vector<Point> buckets(num_buckets, Point::Zero());
+    // The additions that conflict too often are accumulated here instead,
+    // e.g., in the last window whose digits fit in a few buckets.
+    std::vector<Bucket> overflow_buckets(num_buckets, Bucket::Zero());
+
+    size_t batch_size = GetBatchSize(ctx_.window_bits);
+    // |scheduled[j]| is the last batch that adds into the j-th bucket.
+    std::vector<size_t> scheduled(num_buckets, 0);
+    std::vector<Addition> batch;
+    std::vector<Addition> deferred;
+    std::vector<Addition> retried;
+    std::vector<BaseField> denominators;
+    batch.reserve(batch_size);
+    deferred.reserve(batch_size);
+    retried.reserve(batch_size);
+    denominators.reserve(batch_size);
+    size_t batch_index = 1;
+
+    auto add_to_overflow_bucket = [&bases,
+                                   &overflow_buckets](const Addition& addition) {
+      const Point& base = *bases[addition.base_index];
+      if (addition.negative) {
+        overflow_buckets[addition.bucket_index] -= base;
+      } else {
+        overflow_buckets[addition.bucket_index] += base;
+      }
+    };
+
+    // Returns false if |addition| can't be scheduled into the current batch.
+    auto schedule = [&](const Addition& addition) {
+      // A bucket can't be added into twice in a batch, since the second
+      // addition depends on the result of the first one.
+      if (scheduled[addition.bucket_index] == batch_index) return false;
+
+      Point& bucket = buckets[addition.bucket_index];
+      const Point& base = *bases[addition.base_index];
+      if (bucket.infinity()) {
+        bucket = addition.negative ? -base : base;
+      } else if (bucket.x() == base.x()) {
+        // NOTE: This is either a doubling or a cancellation, which is rare
+        // for random bases, so it's done without batching.
+        bucket =
+            (addition.negative ? bucket - base : bucket + base).ToAffine();
+      } else {
+        scheduled[addition.bucket_index] = batch_index;
+        denominators.push_back(base.x() - bucket.x());
+        batch.push_back(addition);
+        if (batch.size() == batch_size) {
+          ApplyBatch(bases, batch, denominators, buckets);
+          ++batch_index;
+        }
+      }
+      return true;
+    };
+
+    for (size_t i = 0; i < bases.size(); ++i) {
+      int64_t digit = scalar_digits[i][window];
+      if (digit == 0) continue;
+      Addition addition{static_cast<size_t>(std::abs(digit) - 1), i,
+                        digit < 0};
+      size_t prev_batch_index = batch_index;
+      if (!schedule(addition)) {
+        if (deferred.size() < batch_size) {
+          deferred.push_back(addition);
+        } else {
+          add_to_overflow_bucket(addition);
+        }
+      }
+      // Retry the deferred additions as soon as a new batch begins.
+      if (prev_batch_index != batch_index && !deferred.empty()) {
+        std::swap(retried, deferred);
+        for (const Addition& retry : retried) {
+          if (!schedule(retry)) deferred.push_back(retry);
+        }
+        retried.clear();
+      }
+    }
+    ApplyBatch(bases, batch, denominators, buckets);
+    for (const Addition& addition : deferred) {
+      add_to_overflow_bucket(addition);
+    }
+
+    *window_sum = AccumulateBuckets(buckets, overflow_buckets);
+  }
+
+  // Adds each base in |batch| into its bucket, where |denominators| are the
+  // differences of their x-coordinates, and clears |batch| and
+  // |denominators|.
+  static void ApplyBatch(const std::vector<const Point*>& bases,
+                         std::vector<Addition>& batch,
+                         std::vector<BaseField>& denominators,
+                         std::vector<Point>& buckets) {
+    if (batch.empty()) return;
+    CHECK(BaseField::BatchInverseInPlaceSerial(denominators));
+    for (size_t i = 0; i < batch.size(); ++i) {
+      Point& bucket = buckets[batch[i].bucket_index];
+      const Point& base = *bases[batch[i].base_index];
+      // λ = (y₂ - y₁) / (x₂ - x₁)
+      // x₃ = λ² - x₁ - x₂
+      // y₃ = λ(x₁ - x₃) - y₁
+      BaseField lambda = batch[i].negative ? -base.y() - bucket.y()
+                                           : base.y() - bucket.y();
+      lambda *= denominators[i];
+      BaseField x = lambda.Square() - bucket.x() - base.x();
+      BaseField y = lambda * (bucket.x() - x) - bucket.y();
+      bucket = Point(std::move(x), std::move(y));
+    }
+    batch.clear();
+    denominators.clear();
+  }
+
+  // Same as |PippengerBase::AccumulateBuckets()| but adds the affine buckets
+  // to the running sum with mixed additions, along with their overflow
+  // buckets if any.
+  static Bucket AccumulateBuckets(const std::vector<Point>& buckets,
+                                  const std::vector<Bucket>& overflow_buckets) {
+    Bucket running_sum = Bucket::Zero();
+    Bucket window_sum = Bucket::Zero();
+    for (size_t i = buckets.size() - 1; i != std::numeric_limits<size_t>::max();
+         --i) {
+      running_sum += buckets[i];
+      if (!overflow_buckets[i].IsZero()) running_sum += overflow_buckets[i];
+      window_sum += running_sum;
+    }
+    return window_sum;
+  }
+
+  bool parallel_windows_ = false;
+  MSMCtx ctx_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_PIPPENGER_H_
@@ -0,0 +1,79 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_pippenger.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Point>
+class BatchAffinePippengerTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G2AffinePoint,
+                   bls12_381::G2AffinePoint>;
+TYPED_TEST_SUITE(BatchAffinePippengerTest, PointTypes);
+
+TYPED_TEST(BatchAffinePippengerTest, Run) {
+  using Point = TypeParam;
+  using Bucket = typename BatchAffinePippenger<Point>::Bucket;
+
+  for (size_t size : {size_t{0}, size_t{1}, size_t{40}, size_t{300}}) {
+    SCOPED_TRACE(absl::Substitute("size: $0", size));
+    VariableBaseMSMTestSet<Point> test_set =
+        VariableBaseMSMTestSet<Point>::Random(size,
+                                              VariableBaseMSMMethod::kNaive);
+    for (bool parallel_windows : {false, true}) {
+      BatchAffinePippenger<Point> pippenger;
+      pippenger.SetParallelWindows(parallel_windows);
+      Bucket ret;
+      ASSERT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
+TYPED_TEST(BatchAffinePippengerTest, RunWithSameBases) {
+  using Point = TypeParam;
+  using Bucket = typename BatchAffinePippenger<Point>::Bucket;
+
+  // The same bases make additions into a bucket doublings or cancellations.
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Easy(100, VariableBaseMSMMethod::kNaive);
+  BatchAffinePippenger<Point> pippenger;
+  Bucket ret;
+  ASSERT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                            test_set.scalars.begin(), test_set.scalars.end(),
+                            &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+TEST(BatchAffinePippengerWindowTest, ComputeWindowBits) {
+  using G1Pippenger = BatchAffinePippenger<bn254::G1AffinePoint>;
+  using G2Pippenger = BatchAffinePippenger<bn254::G2AffinePoint>;
+
+  // An inversion is relatively cheaper in Fp2.
+  EXPECT_LT(G2Pippenger::GetInversionCost(), G1Pippenger::GetInversionCost());
+
+  unsigned int prev_window_bits = 0;
+  for (size_t size = 1; size <= (size_t{1} << 24); size <<= 1) {
+    unsigned int window_bits = G2Pippenger::ComputeWindowBits(size);
+    EXPECT_GE(window_bits, prev_window_bits);
+    EXPECT_LE(window_bits, G1Pippenger::ComputeWindowBits(size));
+    prev_window_bits = window_bits;
+  }
+}
+
+}  // namespace tachyon::math
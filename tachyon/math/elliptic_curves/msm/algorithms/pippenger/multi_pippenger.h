@@ -0,0 +1,231 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_MULTI_PIPPENGER_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_MULTI_PIPPENGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+
+namespace tachyon::math {
+
+// Pippenger's algorithm over many scalar vectors that share the same bases,
+// e.g., the columns committed against the Lagrange bases of an SRS. Running
+// |Pippenger| per vector streams every base from memory once per window and
+// vector, which is bound by the memory bandwidth for large bases with many
+// threads. Instead, this goes over the bases by chunks: the scalars of a chunk
+// are recoded into signed digits for every vector at once, and then every
+// window of every vector adds the bases of the chunk, which stay in the cache,
+// into its buckets.
+//
+// The buckets of every window and vector are kept across the chunks, so the
+// vectors are processed in groups whose buckets fit in |max_buckets_bytes|.
+// To fit more vectors in a group, the window bits may be lowered by up to
+// |kMaxWindowBitsReduction| from the ones of |Pippenger|, which costs a window
+// more per bit but halves the buckets.
+template <typename Point>
+class MultiPippenger : public PippengerBase<Point> {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename PippengerBase<Point>::Bucket;
+
+  template <typename T>
+  using ScratchVector = typename Pippenger<Point>::template ScratchVector<T>;
+
+  constexpr static size_t kDefaultMaxBucketsBytes = size_t{1} << 30;
+  constexpr static unsigned int kMaxWindowBitsReduction = 2;
+  // The maximum number of signed digits of a chunk of bases for every window
+  // and vector, which bounds the bases of a chunk as well.
+  constexpr static size_t kMaxChunkDigits = size_t{1} << 23;
+
+  explicit MultiPippenger(size_t max_buckets_bytes = kDefaultMaxBucketsBytes)
+      : max_buckets_bytes_(max_buckets_bytes) {}
+
+  void SetMaxChunkDigitsForTesting(size_t max_chunk_digits) {
+    max_chunk_digits_ = max_chunk_digits;
+  }
+
+  const MSMCtx& ctx() const { return ctx_; }
+  size_t group_size() const { return group_size_; }
+
+  // Computes |rets[k]| = Σ |scalars_list[k][j]| * |bases[j]| for every k.
+  // Every scalar vector must be as long as |bases|.
+  [[nodiscard]] bool Run(
+      absl::Span<const Point> bases,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      absl::Span<Bucket> rets) {
+    if (scalars_list.size() != rets.size()) {
+      LOG(ERROR) << "scalars_list and rets have different sizes";
+      return false;
+    }
+    for (absl::Span<const ScalarField> scalars : scalars_list) {
+      if (scalars.size() != bases.size()) {
+        LOG(ERROR) << "bases_size and scalars_size don't match";
+        return false;
+      }
+    }
+    if (scalars_list.empty()) return true;
+    if (bases.empty()) {
+      std::fill(rets.begin(), rets.end(), Bucket::Zero());
+      return true;
+    }
+
+    ctx_ = MSMCtx::CreateWithWindowBits<ScalarField>(
+        bases.size(), ComputeWindowBits(bases.size(), scalars_list.size()));
+    group_size_ =
+        std::min(ComputeGroupSize(ctx_.window_bits), scalars_list.size());
+
+    ScratchVector<Bucket> buckets;
+    buckets.resize(group_size_ * GetNumBucketsPerVector());
+    for (size_t offset = 0; offset < scalars_list.size();
+         offset += group_size_) {
+      size_t len = std::min(group_size_, scalars_list.size() - offset);
+      std::fill(buckets.begin(), buckets.end(), Bucket::Zero());
+      RunGroup(bases, scalars_list.subspan(offset, len),
+               absl::MakeSpan(buckets), rets.subspan(offset, len));
+    }
+    return true;
+  }
+
+ private:
+  // Signed digits are in [-2ᶜ⁻¹, 2ᶜ⁻¹], where c is the window bits, except
+  // the last one, which takes the carry.
+  size_t GetBucketSize(size_t window_index) const {
+    if (window_index == ctx_.window_count - 1) {
+      return size_t{1} << ctx_.window_bits;
+    }
+    return size_t{1} << (ctx_.window_bits - 1);
+  }
+
+  static size_t GetNumBucketsPerVector(unsigned int window_bits) {
+    unsigned int window_count =
+        MSMCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    return (size_t{window_count} + 1) << (window_bits - 1);
+  }
+
+  size_t GetNumBucketsPerVector() const {
+    return GetNumBucketsPerVector(ctx_.window_bits);
+  }
+
+  // Returns the buckets of the |window_index|-th window of the
+  // |vector_index|-th scalar vector of a group. The buckets of a window for
+  // every vector of the group are adjacent.
+  absl::Span<Bucket> GetBuckets(absl::Span<Bucket> buckets,
+                                size_t window_index,
+                                size_t vector_index) const {
+    size_t half = size_t{1} << (ctx_.window_bits - 1);
+    size_t bucket_size = GetBucketSize(window_index);
+    return buckets.subspan(
+        window_index * group_size_ * half + vector_index * bucket_size,
+        bucket_size);
+  }
+
+  size_t ComputeGroupSize(unsigned int window_bits) const {
+    size_t bytes_per_vector =
+        GetNumBucketsPerVector(window_bits) * sizeof(Bucket);
+    return std::max(size_t{1}, max_buckets_bytes_ / bytes_per_vector);
+  }
+
+  unsigned int ComputeWindowBits(size_t size, size_t num_scalars) const {
+    unsigned int window_bits = MSMCtx::ComputeWindowsBits(size);
+    for (unsigned int i = 0; i < kMaxWindowBitsReduction; ++i) {
+      if (window_bits <= 3 || ComputeGroupSize(window_bits) >= num_scalars) {
+        break;
+      }
+      --window_bits;
+    }
+    return window_bits;
+  }
+
+  void RunGroup(absl::Span<const Point> bases,
+                absl::Span<const absl::Span<const ScalarField>> scalars_list,
+                absl::Span<Bucket> buckets, absl::Span<Bucket> rets) const {
+    size_t window_count = ctx_.window_count;
+    size_t window_bits = ctx_.window_bits;
+    size_t num_scalars = scalars_list.size();
+    size_t chunk_size =
+        std::max(size_t{1}, max_chunk_digits_ / (num_scalars * window_count));
+    chunk_size = std::min(chunk_size, bases.size());
+
+    // The digits of the i-th window of the k-th scalar vector in a chunk are
+    // adjacent at |scalar_digits[(i * num_scalars + k) * chunk_size]|, so
+    // that a pass over the bases of the chunk reads them in order.
+    ScratchVector<int32_t> scalar_digits;
+    scalar_digits.resize(window_count * num_scalars * chunk_size);
+    int32_t* digits_data = scalar_digits.data();
+    for (size_t offset = 0; offset < bases.size(); offset += chunk_size) {
+      size_t len = std::min(chunk_size, bases.size() - offset);
+      base::ParallelFor(len, [offset, scalars_list, num_scalars, window_count,
+                              window_bits, chunk_size, digits_data](size_t j) {
+        for (size_t k = 0; k < num_scalars; ++k) {
+          StridedDigits<int32_t> digits{digits_data + k * chunk_size + j,
+                                        num_scalars * chunk_size,
+                                        window_count};
+          FillDigits(scalars_list[k][offset + j].ToBigInt(), window_bits,
+                     &digits);
+        }
+      });
+
+      // NOTE: Every window of every vector is added into its own buckets,
+      // one after another per task, so that the buckets being updated are
+      // as many as the ones of |Pippenger|, while the bases of the chunk are
+      // read from the cache.
+      absl::Span<const Point> bases_chunk = bases.subspan(offset, len);
+      base::ParallelFor(
+          window_count * num_scalars,
+          [this, bases_chunk, digits_data, buckets, num_scalars,
+           chunk_size](size_t idx) {
+            size_t i = idx / num_scalars;
+            size_t k = idx % num_scalars;
+            const int32_t* digits = digits_data + idx * chunk_size;
+            absl::Span<Bucket> window_buckets = GetBuckets(buckets, i, k);
+            for (size_t j = 0; j < bases_chunk.size(); ++j) {
+              int32_t digit = digits[j];
+              if (0 < digit) {
+                window_buckets[static_cast<uint32_t>(digit - 1)] +=
+                    bases_chunk[j];
+              } else if (0 > digit) {
+                window_buckets[static_cast<uint32_t>(-digit - 1)] -=
+                    bases_chunk[j];
+              }
+            }
+          },
+          /*grain_size=*/1);
+    }
+
+    // |window_sums[k * window_count + i]| is the sum of the i-th window of
+    // the k-th scalar vector.
+    std::vector<Bucket> window_sums(num_scalars * window_count);
+    base::ParallelFor(num_scalars * window_count,
+                      [this, buckets, window_count, &window_sums](size_t idx) {
+                        size_t k = idx / window_count;
+                        size_t i = idx % window_count;
+                        window_sums[idx] =
+                            PippengerBase<Point>::AccumulateBuckets(
+                                GetBuckets(buckets, i, k));
+                      });
+    for (size_t k = 0; k < num_scalars; ++k) {
+      rets[k] = PippengerBase<Point>::AccumulateWindowSums(
+          absl::MakeConstSpan(window_sums)
+              .subspan(k * window_count, window_count),
+          window_bits);
+    }
+  }
+
+  size_t max_buckets_bytes_;
+  size_t max_chunk_digits_ = kMaxChunkDigits;
+  size_t group_size_ = 0;
+  MSMCtx ctx_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_MULTI_PIPPENGER_H_
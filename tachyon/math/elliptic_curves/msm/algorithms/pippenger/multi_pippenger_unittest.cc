@@ -0,0 +1,148 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/multi_pippenger.h"
+
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+const size_t kNumVectors = 5;
+
+template <typename Point>
+class MultiPippengerTest : public testing::Test {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename MultiPippenger<Point>::Bucket;
+
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+
+  MultiPippengerTest() {
+    bases_ = CreatePseudoRandomPoints<Point>(kSize);
+    scalars_list_ = base::CreateVector(kNumVectors, []() {
+      return base::CreateVector(kSize, []() { return ScalarField::Random(); });
+    });
+    answers_ = base::Map(scalars_list_,
+                         [this](const std::vector<ScalarField>& scalars) {
+                           using AddResult = typename internal::
+                               AdditiveSemigroupTraits<Point>::ReturnTy;
+                           AddResult sum = AddResult::Zero();
+                           for (size_t i = 0; i < kSize; ++i) {
+                             sum += bases_[i] * scalars[i];
+                           }
+                           return ConvertPoint<Bucket>(sum);
+                         });
+  }
+  MultiPippengerTest(const MultiPippengerTest&) = delete;
+  MultiPippengerTest& operator=(const MultiPippengerTest&) = delete;
+  ~MultiPippengerTest() override = default;
+
+  std::vector<absl::Span<const ScalarField>> GetScalarsList() const {
+    return base::Map(scalars_list_,
+                     [](const std::vector<ScalarField>& scalars) {
+                       return absl::MakeConstSpan(scalars);
+                     });
+  }
+
+ protected:
+  std::vector<Point> bases_;
+  std::vector<std::vector<ScalarField>> scalars_list_;
+  std::vector<Bucket> answers_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(MultiPippengerTest, PointTypes);
+
+TYPED_TEST(MultiPippengerTest, Run) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename MultiPippenger<Point>::Bucket;
+
+  std::vector<absl::Span<const ScalarField>> scalars_list =
+      this->GetScalarsList();
+  for (size_t num_vectors = 0; num_vectors <= kNumVectors; ++num_vectors) {
+    SCOPED_TRACE(absl::Substitute("num_vectors: $0", num_vectors));
+    MultiPippenger<Point> pippenger;
+    std::vector<Bucket> rets(num_vectors);
+    ASSERT_TRUE(pippenger.Run(
+        absl::MakeConstSpan(this->bases_),
+        absl::MakeConstSpan(scalars_list).first(num_vectors),
+        absl::MakeSpan(rets)));
+    for (size_t k = 0; k < num_vectors; ++k) {
+      EXPECT_EQ(rets[k], this->answers_[k]);
+    }
+  }
+}
+
+TYPED_TEST(MultiPippengerTest, RunByGroups) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename MultiPippenger<Point>::Bucket;
+
+  std::vector<absl::Span<const ScalarField>> scalars_list =
+      this->GetScalarsList();
+  // The buckets fit a single vector, a few vectors or all of them.
+  for (size_t max_buckets_bytes :
+       {size_t{0}, size_t{1} << 17, size_t{1} << 30}) {
+    SCOPED_TRACE(
+        absl::Substitute("max_buckets_bytes: $0", max_buckets_bytes));
+    MultiPippenger<Point> pippenger(max_buckets_bytes);
+    std::vector<Bucket> rets(kNumVectors);
+    ASSERT_TRUE(pippenger.Run(absl::MakeConstSpan(this->bases_),
+                              absl::MakeConstSpan(scalars_list),
+                              absl::MakeSpan(rets)));
+    EXPECT_EQ(rets, this->answers_);
+  }
+}
+
+TYPED_TEST(MultiPippengerTest, RunByChunks) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename MultiPippenger<Point>::Bucket;
+
+  std::vector<absl::Span<const ScalarField>> scalars_list =
+      this->GetScalarsList();
+  // The chunks have a single base or a few bases.
+  for (size_t max_chunk_digits : {size_t{1}, size_t{1} << 10}) {
+    SCOPED_TRACE(absl::Substitute("max_chunk_digits: $0", max_chunk_digits));
+    MultiPippenger<Point> pippenger;
+    pippenger.SetMaxChunkDigitsForTesting(max_chunk_digits);
+    std::vector<Bucket> rets(kNumVectors);
+    ASSERT_TRUE(pippenger.Run(absl::MakeConstSpan(this->bases_),
+                              absl::MakeConstSpan(scalars_list),
+                              absl::MakeSpan(rets)));
+    EXPECT_EQ(rets, this->answers_);
+  }
+}
+
+TYPED_TEST(MultiPippengerTest, RunWithInvalidArguments) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename MultiPippenger<Point>::Bucket;
+
+  std::vector<absl::Span<const ScalarField>> scalars_list =
+      this->GetScalarsList();
+  MultiPippenger<Point> pippenger;
+  std::vector<Bucket> rets(kNumVectors - 1);
+  EXPECT_FALSE(pippenger.Run(absl::MakeConstSpan(this->bases_),
+                             absl::MakeConstSpan(scalars_list),
+                             absl::MakeSpan(rets)));
+
+  rets.resize(kNumVectors);
+  EXPECT_FALSE(pippenger.Run(absl::MakeConstSpan(this->bases_).first(kSize - 1),
+                             absl::MakeConstSpan(scalars_list),
+                             absl::MakeSpan(rets)));
+}
+
+}  // namespace tachyon::math
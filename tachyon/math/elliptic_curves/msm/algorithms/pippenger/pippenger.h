@@ -14,6 +14,8 @@
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/device/huge_page_arena.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
 #include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
@@ -24,9 +26,9 @@ namespace tachyon::math {
 
 // From:
 // https://github.com/arkworks-rs/gemini/blob/main/src/kzg/msm/variable_base.rs#L20
-template <size_t N>
+template <size_t N, typename Container>
 void FillDigits(const BigInt<N>& scalar, size_t window_bits,
-                std::vector<int64_t>* digits) {
+                Container* digits) {
   uint64_t radix = 1 << window_bits;
 
   uint64_t carry = 0;
@@ -50,6 +52,20 @@ void FillDigits(const BigInt<N>& scalar, size_t window_bits,
   digits->back() += static_cast<int64_t>(carry << window_bits);
 }
 
+// The signed digits of a scalar in a buffer laid out window by window, where
+// the digits of a scalar are |stride| apart from each other. It can be passed
+// to |FillDigits()|.
+template <typename T>
+struct StridedDigits {
+  T* data;
+  size_t stride;
+  size_t count;
+
+  size_t size() const { return count; }
+  T& operator[](size_t i) { return data[i * stride]; }
+  T& back() { return data[(count - 1) * stride]; }
+};
+
 template <typename Point>
 class Pippenger : public PippengerBase<Point> {
  public:
@@ -58,16 +74,28 @@ class Pippenger : public PippengerBase<Point> {
 
   constexpr static size_t N = ScalarField::N;
 
+  // The scratch buffers are allocated from |huge_page_arena()| if there is
+  // one.
+  template <typename T>
+  using ScratchVector = std::vector<T, device::HugePageArenaAllocator<T>>;
+
   Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {
-#if defined(TACHYON_HAS_OPENMP)
+#if defined(TACHYON_HAS_OPENMP) || defined(TACHYON_HAS_WORK_STEALING)
     parallel_windows_ = true;
-#endif  // defined(TACHYON_HAS_OPENMP)
+#endif  // defined(TACHYON_HAS_OPENMP) || defined(TACHYON_HAS_WORK_STEALING)
   }
 
   void SetParallelWindows(bool parallel_windows) {
     parallel_windows_ = parallel_windows;
   }
 
+  device::HugePageArena* huge_page_arena() const { return huge_page_arena_; }
+  // Defaults to the |device::HugePageArena| current on the constructing
+  // thread.
+  void set_huge_page_arena(device::HugePageArena* huge_page_arena) {
+    huge_page_arena_ = huge_page_arena;
+  }
+
   void SetUseMSMWindowNAForTesting(bool use_msm_window_naf) {
     use_msm_window_naf_ = use_msm_window_naf;
   }
@@ -87,20 +115,22 @@ class Pippenger : public PippengerBase<Point> {
     }
     ctx_ = MSMCtx::CreateDefault<ScalarField>(scalars_size);
 
-    std::vector<BigInt<N>> scalars;
-    scalars.resize(scalars_size);
-    auto scalars_it = scalars_first;
-    for (size_t i = 0; i < scalars_size; ++i, ++scalars_it) {
-      scalars[i] = scalars_it->ToBigInt();
-    }
-
     std::vector<Bucket> window_sums =
         base::CreateVector(ctx_.window_count, Bucket::Zero());
 
     if (use_msm_window_naf_) {
-      AccumulateWindowNAFSums(std::move(bases_first), scalars, &window_sums);
+      AccumulateWindowNAFSums(std::move(bases_first), std::move(scalars_first),
+                              scalars_size, &window_sums);
     } else {
-      AccumulateWindowSums(std::move(bases_first), scalars, &window_sums);
+      ScratchVector<BigInt<N>> scalars{
+          device::HugePageArenaAllocator<BigInt<N>>(huge_page_arena_)};
+      scalars.resize(scalars_size);
+      auto scalars_it = scalars_first;
+      for (size_t i = 0; i < scalars_size; ++i, ++scalars_it) {
+        scalars[i] = scalars_it->ToBigInt();
+      }
+      AccumulateWindowSums(std::move(bases_first), absl::MakeConstSpan(scalars),
+                           &window_sums);
     }
 
     *ret = PippengerBase<Point>::AccumulateWindowSums(
@@ -110,10 +140,10 @@ class Pippenger : public PippengerBase<Point> {
 
  private:
   template <typename BaseInputIterator>
-  void AccumulateSingleWindowNAFSum(
-      BaseInputIterator bases_it,
-      const std::vector<std::vector<int64_t>>& scalar_digits, size_t i,
-      Bucket* window_sum, bool is_last_window) {
+  void AccumulateSingleWindowNAFSum(BaseInputIterator bases_it,
+                                    absl::Span<const int32_t> window_digits,
+                                    Bucket* window_sum,
+                                    bool is_last_window) {
     size_t bucket_size;
     if (is_last_window) {
       bucket_size = 1 << ctx_.window_bits;
@@ -122,42 +152,70 @@ class Pippenger : public PippengerBase<Point> {
     }
     std::vector<Bucket> buckets =
         base::CreateVector(bucket_size, Bucket::Zero());
-    for (size_t j = 0; j < scalar_digits.size(); ++j, ++bases_it) {
+    for (size_t j = 0; j < window_digits.size(); ++j, ++bases_it) {
       const Point& base = *bases_it;
-      int64_t scalar = scalar_digits[j][i];
+      int32_t scalar = window_digits[j];
       if (0 < scalar) {
-        buckets[static_cast<uint64_t>(scalar - 1)] += base;
+        buckets[static_cast<uint32_t>(scalar - 1)] += base;
       } else if (0 > scalar) {
-        buckets[static_cast<uint64_t>(-scalar - 1)] -= base;
+        buckets[static_cast<uint32_t>(-scalar - 1)] -= base;
       }
     }
     *window_sum =
         PippengerBase<Point>::AccumulateBuckets(absl::MakeConstSpan(buckets));
   }
 
-  template <typename BaseInputIterator>
+  // Fills the digits of the i-th window of every scalar at
+  // |scalar_digits[i * scalars_size]|, so that a window reads only its own
+  // digits in order. The scalars are converted from montgomery form one at a
+  // time while they are recoded, so that they aren't copied to a vector of
+  // |BigInt|s first.
+  template <typename ScalarInputIterator>
+  void FillScalarDigits(ScalarInputIterator scalars_first, size_t scalars_size,
+                        absl::Span<int32_t> scalar_digits) const {
+    size_t window_count = ctx_.window_count;
+    size_t window_bits = ctx_.window_bits;
+    int32_t* digits_data = scalar_digits.data();
+    auto fill = [scalars_first, scalars_size, window_count, window_bits,
+                 digits_data](size_t j) {
+      StridedDigits<int32_t> digits{digits_data + j, scalars_size,
+                                    window_count};
+      FillDigits((scalars_first + j)->ToBigInt(), window_bits, &digits);
+    };
+    if (parallel_windows_) {
+      base::ParallelFor(scalars_size, fill);
+    } else {
+      for (size_t j = 0; j < scalars_size; ++j) {
+        fill(j);
+      }
+    }
+  }
+
+  template <typename BaseInputIterator, typename ScalarInputIterator>
   void AccumulateWindowNAFSums(BaseInputIterator bases_first,
-                               absl::Span<const BigInt<N>> scalars,
+                               ScalarInputIterator scalars_first,
+                               size_t scalars_size,
                                std::vector<Bucket>* window_sums) {
-    std::vector<std::vector<int64_t>> scalar_digits;
-    scalar_digits.resize(scalars.size());
-    for (std::vector<int64_t>& scalar_digit : scalar_digits) {
-      scalar_digit.resize(ctx_.window_count);
-    }
-    for (size_t i = 0; i < scalars.size(); ++i) {
-      FillDigits(scalars[i], ctx_.window_bits, &scalar_digits[i]);
-    }
+    // NOTE: The digits of all the scalars are kept in a single buffer instead
+    // of a vector per scalar. A digit is at most 2ᶜ in absolute value, where c
+    // is the window bits, so it fits in an |int32_t|.
+    ScratchVector<int32_t> scalar_digits{
+        device::HugePageArenaAllocator<int32_t>(huge_page_arena_)};
+    scalar_digits.resize(scalars_size * ctx_.window_count);
+    FillScalarDigits(std::move(scalars_first), scalars_size,
+                     absl::MakeSpan(scalar_digits));
+    absl::Span<const int32_t> digits = absl::MakeConstSpan(scalar_digits);
+    auto accumulate = [this, &bases_first, digits, scalars_size,
+                       window_sums](size_t i) {
+      AccumulateSingleWindowNAFSum(
+          bases_first, digits.subspan(i * scalars_size, scalars_size),
+          &(*window_sums)[i], i == ctx_.window_count - 1);
+    };
     if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
-                                     &(*window_sums)[i],
-                                     i == ctx_.window_count - 1);
-      }
+      base::ParallelFor(ctx_.window_count, accumulate, /*grain_size=*/1);
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
-                                     &(*window_sums)[i],
-                                     i == ctx_.window_count - 1);
+        accumulate(i);
       }
     }
   }
@@ -209,10 +267,14 @@ class Pippenger : public PippengerBase<Point> {
                             absl::Span<const BigInt<N>> scalars,
                             std::vector<Bucket>* window_sums) {
     if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
-                                  &(*window_sums)[i]);
-      }
+      base::ParallelFor(
+          ctx_.window_count,
+          [this, &bases_first, scalars, window_sums](size_t i) {
+            AccumulateSingleWindowSum(bases_first, scalars,
+                                      ctx_.window_bits * i,
+                                      &(*window_sums)[i]);
+          },
+          /*grain_size=*/1);
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
         AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
@@ -223,6 +285,8 @@ class Pippenger : public PippengerBase<Point> {
 
   bool use_msm_window_naf_ = false;
   bool parallel_windows_ = false;
+  device::HugePageArena* huge_page_arena_ =
+      device::HugePageArena::GetCurrent();
   MSMCtx ctx_;
 };
 
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/device/huge_page_arena.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
 
 namespace tachyon::math {
@@ -59,7 +60,12 @@ class PippengerAdapter {
         return true;
       }
 
-#if defined(TACHYON_HAS_OPENMP)
+#if defined(TACHYON_HAS_WORK_STEALING)
+      // NOTE: The windows of every chunk run on the same workers as the
+      // chunks, so the number of chunks isn't cut down for them.
+      int thread_nums = static_cast<int>(
+          base::WorkStealingThreadPool::GetInstance()->num_threads());
+#elif defined(TACHYON_HAS_OPENMP)
       int thread_nums = omp_get_max_threads();
       if (strategy == PippengerParallelStrategy::kParallelWindowAndTerm) {
         size_t window_bits = MSMCtx::ComputeWindowsBits(scalars_size);
@@ -69,32 +75,43 @@ class PippengerAdapter {
       }
 #else
       int thread_nums = 1;
-#endif  // defined(TACHYON_HAS_OPENMP)
+#endif
       struct Result {
         Bucket value;
         bool valid;
       };
 
-#if defined(TACHYON_HAS_OPENMP)
+#if defined(TACHYON_HAS_OPENMP) && !defined(TACHYON_HAS_WORK_STEALING)
       omp_set_num_threads(thread_nums);
 #endif
+      // NOTE: The chunks run on the workers, which don't see the
+      // |device::HugePageArena| current on this thread, so it is handed to
+      // them explicitly.
+      device::HugePageArena* huge_page_arena =
+          device::HugePageArena::GetCurrent();
       size_t chunk_size = (scalars_size + thread_nums - 1) / thread_nums;
       size_t num_chunks = (scalars_size + chunk_size - 1) / chunk_size;
       std::vector<Result> results;
       results.resize(num_chunks);
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
-        size_t start = i * chunk_size;
-        size_t len = i == num_chunks - 1 ? scalars_size - start : chunk_size;
-        Pippenger<Point> pippenger;
-        pippenger.SetParallelWindows(
-            strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
-        auto bases_start = bases_first + start;
-        auto bases_end = bases_start + len;
-        auto scalars_start = scalars_first + start;
-        auto scalars_end = scalars_start + len;
-        results[i].valid = pippenger.Run(bases_start, bases_end, scalars_start,
-                                         scalars_end, &results[i].value);
-      }
+      base::ParallelFor(
+          num_chunks,
+          [&](size_t i) {
+            size_t start = i * chunk_size;
+            size_t len =
+                i == num_chunks - 1 ? scalars_size - start : chunk_size;
+            Pippenger<Point> pippenger;
+            pippenger.set_huge_page_arena(huge_page_arena);
+            pippenger.SetParallelWindows(
+                strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
+            auto bases_start = bases_first + start;
+            auto bases_end = bases_start + len;
+            auto scalars_start = scalars_first + start;
+            auto scalars_end = scalars_start + len;
+            results[i].valid =
+                pippenger.Run(bases_start, bases_end, scalars_start,
+                              scalars_end, &results[i].value);
+          },
+          /*grain_size=*/1);
 
       bool all_good =
           std::all_of(results.begin(), results.end(),
@@ -1,5 +1,7 @@
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
 
+#include <optional>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
@@ -47,4 +49,38 @@ TEST_F(PippengerAdapterTest, RunWithStrategy) {
   }
 }
 
+TEST_F(PippengerAdapterTest, RunWithHugePageArena) {
+  const VariableBaseMSMTestSet<bn254::G1AffinePoint>& test_set =
+      this->test_set_;
+
+  device::HugePageArena::Options options;
+  options.page_size = device::HugePageArena::PageSize::kDefault;
+  options.block_size = size_t{1} << 21;
+  device::HugePageArena arena(options);
+  device::ScopedHugePageArena scoped_arena(&arena);
+  PippengerAdapter<bn254::G1AffinePoint> pippenger;
+  bn254::G1PointXYZZ ret;
+  EXPECT_TRUE(pippenger.RunWithStrategy(
+      test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
+      test_set.scalars.end(), PippengerParallelStrategy::kParallelTerm, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+
+  // NOTE: Every chunk allocates its scratch buffer from the arena, including
+  // the ones that run on the workers.
+#if defined(TACHYON_HAS_WORK_STEALING)
+  size_t thread_nums =
+      base::WorkStealingThreadPool::GetInstance()->num_threads();
+#elif defined(TACHYON_HAS_OPENMP)
+  size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+  size_t thread_nums = 1;
+#endif
+  size_t chunk_size = (kSize + thread_nums - 1) / thread_nums;
+  size_t num_chunks = (kSize + chunk_size - 1) / chunk_size;
+  std::optional<device::AllocatorStats> stats = arena.GetStats();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(stats->num_allocs, static_cast<int64_t>(num_chunks));
+  EXPECT_EQ(stats->bytes_in_use, 0);
+}
+
 }  // namespace tachyon::math
@@ -69,4 +69,30 @@ TYPED_TEST(PippengerTest, Run) {
   }
 }
 
+TYPED_TEST(PippengerTest, RunWithHugePageArena) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  device::HugePageArena::Options options;
+  options.page_size = device::HugePageArena::PageSize::kDefault;
+  options.block_size = size_t{1} << 21;
+  device::HugePageArena arena(options);
+  device::ScopedHugePageArena scoped_arena(&arena);
+  for (bool use_window_naf : {false, true}) {
+    Pippenger<Point> pippenger;
+    pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+    Bucket ret;
+    EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                              test_set.scalars.begin(), test_set.scalars.end(),
+                              &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+  std::optional<device::AllocatorStats> stats = arena.GetStats();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_GT(stats->num_allocs, 0);
+  EXPECT_EQ(stats->bytes_in_use, 0);
+}
+
 }  // namespace tachyon::math
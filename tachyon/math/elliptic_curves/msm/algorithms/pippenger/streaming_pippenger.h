@@ -0,0 +1,172 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_STREAMING_PIPPENGER_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_STREAMING_PIPPENGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/msm_util.h"
+
+namespace tachyon::math {
+
+// Pippenger's algorithm over bases and scalars given by chunks, e.g., read
+// from a file or a memory mapping one after another. Only the buckets of
+// every window are kept across the chunks, so the memory besides them is
+// bounded by the chunk size: a chunk of scalars is converted from montgomery
+// form into signed digits right before its bases are added to the buckets.
+// The sum is the same as |Pippenger| over the whole bases and scalars.
+template <typename Point>
+class StreamingPippenger : public PippengerBase<Point> {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename PippengerBase<Point>::Bucket;
+
+  // The number of bases and scalars that |Run()| adds at a time by default.
+  constexpr static size_t kDefaultChunkSize = size_t{1} << 16;
+
+  // |size| is the total number of bases, from which the window bits are
+  // chosen the same as |Pippenger|. This doesn't limit the number of bases
+  // |Add()| takes.
+  explicit StreamingPippenger(size_t size)
+      : ctx_(MSMCtx::CreateDefault<ScalarField>(size)) {
+    buckets_.resize(ctx_.window_count);
+    for (size_t i = 0; i < ctx_.window_count; ++i) {
+      buckets_[i] = base::CreateVector(GetBucketSize(i), Bucket::Zero());
+    }
+  }
+
+  const MSMCtx& ctx() const { return ctx_; }
+
+  // Adds sᵢ * gᵢ of a chunk of |bases| and |scalars| into the buckets.
+  template <typename BaseInputIterator, typename ScalarInputIterator,
+            std::enable_if_t<IsAbleToMSM<BaseInputIterator, ScalarInputIterator,
+                                         Point, ScalarField>>* = nullptr>
+  [[nodiscard]] bool Add(BaseInputIterator bases_first,
+                         BaseInputIterator bases_last,
+                         ScalarInputIterator scalars_first,
+                         ScalarInputIterator scalars_last) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (bases_size != scalars_size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+
+    if (scalar_digits_.size() < scalars_size) {
+      scalar_digits_.resize(scalars_size);
+      for (std::vector<int64_t>& scalar_digit : scalar_digits_) {
+        scalar_digit.resize(ctx_.window_count);
+      }
+    }
+    auto scalars_it = scalars_first;
+    for (size_t i = 0; i < scalars_size; ++i, ++scalars_it) {
+      FillDigits(scalars_it->ToBigInt(), ctx_.window_bits, &scalar_digits_[i]);
+    }
+
+    base::ParallelFor(
+        ctx_.window_count,
+        [this, &bases_first, scalars_size](size_t i) {
+          std::vector<Bucket>& buckets = buckets_[i];
+          auto bases_it = bases_first;
+          for (size_t j = 0; j < scalars_size; ++j, ++bases_it) {
+            int64_t digit = scalar_digits_[j][i];
+            if (0 < digit) {
+              buckets[static_cast<uint64_t>(digit - 1)] += *bases_it;
+            } else if (0 > digit) {
+              buckets[static_cast<uint64_t>(-digit - 1)] -= *bases_it;
+            }
+          }
+        },
+        /*grain_size=*/1);
+    return true;
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  [[nodiscard]] bool Add(const BaseContainer& bases,
+                         const ScalarContainer& scalars) {
+    return Add(std::begin(bases), std::end(bases), std::begin(scalars),
+               std::end(scalars));
+  }
+
+  // Returns the sum of what has been added so far. The buckets are kept, so
+  // more chunks can be added after this.
+  Bucket Finalize() const {
+    std::vector<Bucket> window_sums(ctx_.window_count);
+    base::ParallelFor(
+        ctx_.window_count,
+        [this, &window_sums](size_t i) {
+          window_sums[i] = PippengerBase<Point>::AccumulateBuckets(
+              absl::MakeConstSpan(buckets_[i]));
+        },
+        /*grain_size=*/1);
+    return PippengerBase<Point>::AccumulateWindowSums(
+        absl::MakeConstSpan(window_sums), ctx_.window_bits);
+  }
+
+  // Runs the MSM over |bases| and |scalars| by chunks of |chunk_size|.
+  template <typename BaseInputIterator, typename ScalarInputIterator,
+            std::enable_if_t<IsAbleToMSM<BaseInputIterator, ScalarInputIterator,
+                                         Point, ScalarField>>* = nullptr>
+  [[nodiscard]] static bool Run(BaseInputIterator bases_first,
+                                BaseInputIterator bases_last,
+                                ScalarInputIterator scalars_first,
+                                ScalarInputIterator scalars_last,
+                                size_t chunk_size, Bucket* ret) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (bases_size != scalars_size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+    if (chunk_size == 0) {
+      LOG(ERROR) << "chunk_size is 0";
+      return false;
+    }
+
+    StreamingPippenger pippenger(scalars_size);
+    for (size_t offset = 0; offset < scalars_size; offset += chunk_size) {
+      size_t len = std::min(chunk_size, scalars_size - offset);
+      auto bases_chunk_last = std::next(bases_first, len);
+      auto scalars_chunk_last = std::next(scalars_first, len);
+      if (!pippenger.Add(bases_first, bases_chunk_last, scalars_first,
+                         scalars_chunk_last)) {
+        return false;
+      }
+      bases_first = std::move(bases_chunk_last);
+      scalars_first = std::move(scalars_chunk_last);
+    }
+    *ret = pippenger.Finalize();
+    return true;
+  }
+
+ private:
+  // Signed digits are in [-2ᶜ⁻¹, 2ᶜ⁻¹], where c is the window bits, except
+  // the last one, which takes the carry.
+  size_t GetBucketSize(size_t window_index) const {
+    if (window_index == ctx_.window_count - 1) {
+      return size_t{1} << ctx_.window_bits;
+    }
+    return size_t{1} << (ctx_.window_bits - 1);
+  }
+
+  MSMCtx ctx_;
+  // The buckets of each window.
+  std::vector<std::vector<Bucket>> buckets_;
+  // The signed digits of the current chunk, which are reused by chunks.
+  std::vector<std::vector<int64_t>> scalar_digits_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_STREAMING_PIPPENGER_H_
@@ -0,0 +1,93 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/streaming_pippenger.h"
+
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename Point>
+class StreamingPippengerTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+
+  StreamingPippengerTest()
+      : test_set_(VariableBaseMSMTestSet<Point>::Random(
+            kSize, VariableBaseMSMMethod::kNaive)) {}
+  StreamingPippengerTest(const StreamingPippengerTest&) = delete;
+  StreamingPippengerTest& operator=(const StreamingPippengerTest&) = delete;
+  ~StreamingPippengerTest() override = default;
+
+ protected:
+  VariableBaseMSMTestSet<Point> test_set_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(StreamingPippengerTest, PointTypes);
+
+TYPED_TEST(StreamingPippengerTest, Run) {
+  using Point = TypeParam;
+  using Bucket = typename StreamingPippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  // The chunk sizes divide |kSize| or not, or exceed it.
+  for (size_t chunk_size : {size_t{1}, size_t{7}, size_t{8}, kSize, 2 * kSize}) {
+    SCOPED_TRACE(absl::Substitute("chunk_size: $0", chunk_size));
+    Bucket ret;
+    ASSERT_TRUE(StreamingPippenger<Point>::Run(
+        test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
+        test_set.scalars.end(), chunk_size, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+
+  Bucket ret;
+  EXPECT_FALSE(StreamingPippenger<Point>::Run(
+      test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
+      test_set.scalars.end(), 0, &ret));
+  EXPECT_FALSE(StreamingPippenger<Point>::Run(
+      test_set.bases.begin(), test_set.bases.end() - 1,
+      test_set.scalars.begin(), test_set.scalars.end(), 8, &ret));
+}
+
+TYPED_TEST(StreamingPippengerTest, Add) {
+  using Point = TypeParam;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  StreamingPippenger<Point> pippenger(kSize);
+  EXPECT_TRUE(pippenger.Finalize().IsZero());
+
+  size_t half = kSize / 2;
+  ASSERT_TRUE(pippenger.Add(absl::MakeConstSpan(test_set.bases).first(half),
+                            absl::MakeConstSpan(test_set.scalars).first(half)));
+  ASSERT_TRUE(pippenger.Add(absl::MakeConstSpan(test_set.bases).subspan(half),
+                            absl::MakeConstSpan(test_set.scalars).subspan(half)));
+  EXPECT_EQ(pippenger.Finalize(), test_set.answer);
+
+  // The buckets are kept after |Finalize()|.
+  ASSERT_TRUE(pippenger.Add(absl::MakeConstSpan(test_set.bases).first(half),
+                            absl::MakeConstSpan(test_set.scalars).first(half)));
+  StreamingPippenger<Point> first_half(half);
+  ASSERT_TRUE(
+      first_half.Add(absl::MakeConstSpan(test_set.bases).first(half),
+                     absl::MakeConstSpan(test_set.scalars).first(half)));
+  EXPECT_EQ(pippenger.Finalize(), test_set.answer + first_half.Finalize());
+
+  EXPECT_FALSE(pippenger.Add(absl::MakeConstSpan(test_set.bases).first(half),
+                             absl::MakeConstSpan(test_set.scalars)));
+}
+
+}  // namespace tachyon::math
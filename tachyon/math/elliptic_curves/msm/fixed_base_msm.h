@@ -34,6 +34,15 @@ class FixedBaseMSM {
     UpdateWindowTable(base);
   }
 
+  // Same as above, but the window table is built with |window_bits|, which
+  // bounds its size to ⌈b / W⌉ * 2ᵂ points, where b is the bit size of
+  // |ScalarField| and W is |window_bits|.
+  constexpr void Reset(size_t size, unsigned int window_bits,
+                       const Point& base) {
+    ctx_ = MSMCtx::CreateWithWindowBits<ScalarField>(size, window_bits);
+    UpdateWindowTable(base);
+  }
+
   constexpr AddResult ScalarMul(const ScalarField& scalar) const {
     // modulus_bits = 254
     // window_bits = 5
@@ -25,6 +25,16 @@ struct TACHYON_EXPORT MSMCtx {
     return ctx;
   }
 
+  template <typename ScalarField>
+  constexpr static MSMCtx CreateWithWindowBits(size_t size,
+                                               unsigned int window_bits) {
+    MSMCtx ctx;
+    ctx.window_bits = window_bits;
+    ctx.window_count = ComputeWindowsCount<ScalarField>(ctx.window_bits);
+    ctx.size = size;
+    return ctx;
+  }
+
   // The result of this function is only approximately `ln(a)`.
   // See https://github.com/scipr-lab/zexe/issues/79#issue-556220473
   constexpr static unsigned int LnWithoutFloats(size_t a) {
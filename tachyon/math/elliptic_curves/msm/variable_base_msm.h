@@ -1,9 +1,15 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/multi_pippenger.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/streaming_pippenger.h"
 
 namespace tachyon::math {
 
@@ -18,11 +24,34 @@ class VariableBaseMSM {
   using ScalarField = typename Point::ScalarField;
   using Bucket = typename Pippenger<Point>::Bucket;
 
+  // From this number of affine bases over an extension field, e.g., G2, the
+  // buckets are accumulated in affine coordinates by |BatchAffinePippenger|.
+  // Below it, the batches are too small to amortize the inversions.
+  constexpr static size_t kBatchAffineThreshold = size_t{1} << 10;
+
+  constexpr static bool CanUseBatchAffine() {
+    if constexpr (std::is_same_v<Point,
+                                 AffinePoint<typename Point::Curve>>) {
+      return Point::BaseField::ExtensionDegree() > 1;
+    } else {
+      return false;
+    }
+  }
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   [[nodiscard]] bool Run(BaseInputIterator bases_first,
                          BaseInputIterator bases_last,
                          ScalarInputIterator scalars_first,
                          ScalarInputIterator scalars_last, Bucket* ret) {
+    if constexpr (CanUseBatchAffine()) {
+      if (static_cast<size_t>(std::distance(bases_first, bases_last)) >=
+          kBatchAffineThreshold) {
+        BatchAffinePippenger<Point> pippenger;
+        return pippenger.Run(std::move(bases_first), std::move(bases_last),
+                             std::move(scalars_first), std::move(scalars_last),
+                             ret);
+      }
+    }
     PippengerAdapter<Point> pippenger;
     return pippenger.Run(std::move(bases_first), std::move(bases_last),
                          std::move(scalars_first), std::move(scalars_last),
@@ -35,6 +64,41 @@ class VariableBaseMSM {
     return Run(std::begin(bases), std::end(bases), std::begin(scalars),
                std::end(scalars), ret);
   }
+
+  // Same as |Run()|, but adds |bases| and |scalars| to the buckets by chunks
+  // of |chunk_size| with |StreamingPippenger|, so that the scalars aren't
+  // converted from montgomery form all at once. This suits bases and scalars
+  // that don't fit in memory, e.g., the ones mapped from files.
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  [[nodiscard]] bool RunByChunks(
+      BaseInputIterator bases_first, BaseInputIterator bases_last,
+      ScalarInputIterator scalars_first, ScalarInputIterator scalars_last,
+      Bucket* ret,
+      size_t chunk_size = StreamingPippenger<Point>::kDefaultChunkSize) {
+    return StreamingPippenger<Point>::Run(
+        std::move(bases_first), std::move(bases_last),
+        std::move(scalars_first), std::move(scalars_last), chunk_size, ret);
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  [[nodiscard]] bool RunByChunks(
+      const BaseContainer& bases, const ScalarContainer& scalars, Bucket* ret,
+      size_t chunk_size = StreamingPippenger<Point>::kDefaultChunkSize) {
+    return RunByChunks(std::begin(bases), std::end(bases), std::begin(scalars),
+                       std::end(scalars), ret, chunk_size);
+  }
+
+  // Runs the MSM of every vector of |scalars_list| over the same |bases| and
+  // populates |rets| with them. Unlike calling |Run()| per vector,
+  // |MultiPippenger| reads |bases| once for all the vectors, so this suits
+  // many vectors over large bases, e.g., the columns of a circuit.
+  [[nodiscard]] bool RunMulti(
+      absl::Span<const Point> bases,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      absl::Span<Bucket> rets) {
+    MultiPippenger<Point> pippenger;
+    return pippenger.Run(bases, scalars_list, rets);
+  }
 };
 
 }  // namespace tachyon::math
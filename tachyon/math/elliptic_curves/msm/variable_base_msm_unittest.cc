@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g2.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
 #include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
 
 namespace tachyon::math {
@@ -29,7 +31,8 @@ class VariableBaseMSMTest : public testing::Test {
 
 using PointTypes =
     testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
-                   bn254::G1JacobianPoint, bn254::G1PointXYZZ>;
+                   bn254::G1JacobianPoint, bn254::G1PointXYZZ,
+                   bn254::G2AffinePoint, bls12_381::G2AffinePoint>;
 TYPED_TEST_SUITE(VariableBaseMSMTest, PointTypes);
 
 TYPED_TEST(VariableBaseMSMTest, DoMSM) {
@@ -44,4 +47,36 @@ TYPED_TEST(VariableBaseMSMTest, DoMSM) {
   EXPECT_EQ(ret, test_set.answer);
 }
 
+TYPED_TEST(VariableBaseMSMTest, DoMSMByChunks) {
+  using Point = TypeParam;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  VariableBaseMSM<Point> msm;
+  Bucket ret;
+  EXPECT_TRUE(msm.RunByChunks(test_set.bases, test_set.scalars, &ret,
+                              /*chunk_size=*/16));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+TYPED_TEST(VariableBaseMSMTest, DoMSMWithBatchAffine) {
+  using Point = TypeParam;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+
+  if constexpr (VariableBaseMSM<Point>::CanUseBatchAffine()) {
+    VariableBaseMSMTestSet<Point> test_set =
+        VariableBaseMSMTestSet<Point>::Random(
+            VariableBaseMSM<Point>::kBatchAffineThreshold,
+            VariableBaseMSMMethod::kNaive);
+
+    VariableBaseMSM<Point> msm;
+    Bucket ret;
+    EXPECT_TRUE(msm.Run(test_set.bases, test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  } else {
+    GTEST_SKIP() << "Batch affine is used only for G2 affine points";
+  }
+}
+
 }  // namespace tachyon::math
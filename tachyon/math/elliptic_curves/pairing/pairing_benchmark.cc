@@ -0,0 +1,87 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/bls12_381.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+
+namespace tachyon::math {
+
+template <typename Curve>
+void Init() {
+  Curve::G1Curve::Init();
+  Curve::G2Curve::Init();
+  Curve::Init();
+}
+
+template <typename Curve>
+void BM_MultiMillerLoop(benchmark::State& state) {
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+
+  Init<Curve>();
+  std::vector<G1AffinePoint> g1s = base::CreateVector(
+      state.range(0), []() { return G1AffinePoint::Random(); });
+  std::vector<G2Prepared> g2s = base::CreateVector(state.range(0), []() {
+    return G2Prepared::From(G2AffinePoint::Random());
+  });
+  Fp12 ret;
+  for (auto _ : state) {
+    ret = Curve::MultiMillerLoop(g1s, g2s);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename Curve>
+void BM_FinalExponentiation(benchmark::State& state) {
+  using Fp12 = typename Curve::Fp12;
+
+  Init<Curve>();
+  Fp12 f = Fp12::Random();
+  Fp12 ret;
+  for (auto _ : state) {
+    ret = Curve::FinalExponentiation(f);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename Curve>
+void BM_Pairing(benchmark::State& state) {
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+
+  Init<Curve>();
+  std::vector<G1AffinePoint> g1s = base::CreateVector(
+      state.range(0), []() { return G1AffinePoint::Random(); });
+  std::vector<G2Prepared> g2s = base::CreateVector(state.range(0), []() {
+    return G2Prepared::From(G2AffinePoint::Random());
+  });
+  Fp12 ret;
+  for (auto _ : state) {
+    ret = Pairing<Curve>(g1s, g2s);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+BENCHMARK_TEMPLATE(BM_MultiMillerLoop, bn254::BN254Curve)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 4);
+BENCHMARK_TEMPLATE(BM_MultiMillerLoop, bls12_381::BLS12_381Curve)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 4);
+BENCHMARK_TEMPLATE(BM_FinalExponentiation, bn254::BN254Curve);
+BENCHMARK_TEMPLATE(BM_FinalExponentiation, bls12_381::BLS12_381Curve);
+BENCHMARK_TEMPLATE(BM_Pairing, bn254::BN254Curve)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 4);
+BENCHMARK_TEMPLATE(BM_Pairing, bls12_381::BLS12_381Curve)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 4);
+
+}  // namespace tachyon::math
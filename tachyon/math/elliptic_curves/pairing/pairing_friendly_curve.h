@@ -39,8 +39,11 @@ class PairingFriendlyCurve {
     mutable size_t idx_ = 0;
   };
 
+  // NOTE: |PowByX()| and |PowByNegX()| are only called in the hard part of
+  // the final exponentiation, where |f_in| is in the cyclotomic subgroup. So
+  // the compressed squaring can be used.
   static Fp12 PowByX(const Fp12& f_in) {
-    Fp12 f = f_in.CyclotomicPow(Config::kX);
+    Fp12 f = f_in.CompressedCyclotomicPow(Config::kX);
     if constexpr (Config::kXIsNegative) {
       f.CyclotomicInverseInPlace();
     }
@@ -48,7 +51,7 @@ class PairingFriendlyCurve {
   }
 
   static Fp12 PowByNegX(const Fp12& f_in) {
-    Fp12 f = f_in.CyclotomicPow(Config::kX);
+    Fp12 f = f_in.CompressedCyclotomicPow(Config::kX);
     if constexpr (!Config::kXIsNegative) {
       f.CyclotomicInverseInPlace();
     }
@@ -4,11 +4,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <optional>
 #include <ostream>
 #include <string>
 
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/base/safe_gcd.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
 extern "C" void Fec_rawAdd(uint64_t result[4], const uint64_t a[4],
@@ -205,12 +207,27 @@ class PrimeField<_Config, std::enable_if_t<_Config::kIsSecp256k1Fq>> final
   }
 
   constexpr PrimeField& InverseInPlace() {
-    value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
-        Config::kModulus, Config::kMontgomeryR2);
-    return *this;
+    // NOTE: The inverse of aR is a⁻¹R⁻¹, so the Montgomery multiplication by
+    // R³ gives a⁻¹R.
+    value_ = kSafeGcd.Inverse(value_);
+    return MulInPlace(PrimeField::FromMontgomery(Config::kMontgomeryR3));
+  }
+
+  // PrimeFieldBase methods
+  LegendreSymbol Legendre() const {
+    if (IsZero()) return LegendreSymbol::kZero;
+    // NOTE: R = 2⁶⁴ᴺ is a square, so the symbol of aR is the one of a.
+    std::optional<int> jacobi = kSafeGcd.Jacobi(value_);
+    if (!jacobi.has_value()) {
+      return PrimeFieldBase<PrimeField>::Legendre();
+    }
+    return *jacobi == 1 ? LegendreSymbol::kOne : LegendreSymbol::kMinusOne;
   }
 
  private:
+  constexpr static SafeGcd<N> kSafeGcd =
+      SafeGcd<N>(Config::kModulus, Config::kModulusInverse62);
+
   BigInt<N> value_;
 };
 
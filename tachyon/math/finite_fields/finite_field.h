@@ -1,8 +1,13 @@
 #ifndef TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 #define TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 
+#include <iterator>
+#include <utility>
+
+#include "tachyon/base/logging.h"
 #include "tachyon/math/base/field.h"
 #include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/sarkar.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/shanks.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/tonelli_shanks.h"
 
@@ -25,12 +30,58 @@ class FiniteField : public Field<F> {
       return ComputeShanksSquareRoot(*static_cast<const F*>(this), ret);
     } else {
       static_assert(Config::kHasTwoAdicRootOfUnity);
-      return ComputeTonelliShanksSquareRoot(
-          *static_cast<const F*>(this),
-          F::FromMontgomery(Config::kTwoAdicRootOfUnity), ret);
+      if constexpr (SarkarSquareRoot<F>::kIsEnabled) {
+        return ComputeSarkarSquareRoot(*static_cast<const F*>(this), ret);
+      } else {
+        return ComputeTonelliShanksSquareRoot(
+            *static_cast<const F*>(this),
+            F::FromMontgomery(Config::kTwoAdicRootOfUnity), ret);
+      }
     }
     return false;
   }
+
+  // Square roots: [a₁, a₂, ..., aₙ] -> [√a₁, √a₂, ..., √aₙ]
+  // Returns false if the sizes don't match or any of |values| is a non
+  // quadratic residue. The windows of the exponent and the tables of a prime
+  // field are looked up once for all of |values|.
+  template <typename InputContainer, typename OutputContainer>
+  [[nodiscard]] static bool SquareRoots(const InputContainer& values,
+                                        OutputContainer* roots) {
+    size_t size = std::size(values);
+    if (size != std::size(*roots)) {
+      LOG(ERROR) << "Size of |values| and |roots| do not match";
+      return false;
+    }
+    if constexpr (FiniteFieldTraits<F>::kIsPrimeField) {
+      if constexpr (Config::kModulusModFourIsThree) {
+        const FixedWindowPow<F>& pow = GetShanksPow<F>();
+        for (size_t i = 0; i < size; ++i) {
+          const F& value = std::data(values)[i];
+          F sqrt = pow.Pow(value);
+          if (sqrt.Square() != value) return false;
+          std::data(*roots)[i] = std::move(sqrt);
+        }
+        return true;
+      } else if constexpr (SarkarSquareRoot<F>::kIsEnabled) {
+        const SarkarSquareRoot<F>& sarkar = SarkarSquareRoot<F>::GetInstance();
+        const FixedWindowPow<F>& pow = sarkar.trace_minus_one_div_two_pow();
+        for (size_t i = 0; i < size; ++i) {
+          const F& value = std::data(values)[i];
+          if (!sarkar.Compute(value, pow.Pow(value), &std::data(*roots)[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+    }
+    for (size_t i = 0; i < size; ++i) {
+      if (!std::data(values)[i].SquareRoot(&std::data(*roots)[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 }  // namespace tachyon::math
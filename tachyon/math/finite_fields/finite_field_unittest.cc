@@ -1,5 +1,9 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
+
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 
@@ -40,4 +44,49 @@ TYPED_TEST(FiniteFieldTest, SquareRoot) {
   EXPECT_TRUE(success);
 }
 
+TYPED_TEST(FiniteFieldTest, SquareRootMatchesTonelliShanks) {
+  using F = TypeParam;
+
+  if constexpr (!F::Config::kModulusModFourIsThree) {
+    F quadratic_non_residue_to_trace =
+        F::FromMontgomery(F::Config::kTwoAdicRootOfUnity);
+    for (size_t i = 0; i < 100; ++i) {
+      F f = F::Random();
+      F expected;
+      bool has_root = ComputeTonelliShanksSquareRoot(
+          f, quadratic_non_residue_to_trace, &expected);
+      F sqrt;
+      ASSERT_EQ(f.SquareRoot(&sqrt), has_root);
+      if (has_root) {
+        EXPECT_TRUE(sqrt == expected || sqrt == -expected);
+      }
+    }
+  } else {
+    GTEST_SKIP() << "The modulus is 3 mod 4";
+  }
+}
+
+TYPED_TEST(FiniteFieldTest, SquareRoots) {
+  using F = TypeParam;
+
+  std::vector<F> squares =
+      base::CreateVector(100, []() { return F::Random().Square(); });
+  squares[0] = F::Zero();
+  std::vector<F> roots(squares.size());
+  ASSERT_TRUE(F::SquareRoots(squares, &roots));
+  for (size_t i = 0; i < squares.size(); ++i) {
+    EXPECT_EQ(roots[i].Square(), squares[i]);
+  }
+
+  F non_residue = F::Random();
+  while (non_residue.Legendre() != LegendreSymbol::kMinusOne) {
+    non_residue = F::Random();
+  }
+  squares.back() = non_residue;
+  EXPECT_FALSE(F::SquareRoots(squares, &roots));
+
+  std::vector<F> wrong_size_roots(squares.size() - 1);
+  EXPECT_FALSE(F::SquareRoots(squares, &wrong_size_roots));
+}
+
 }  // namespace tachyon::math
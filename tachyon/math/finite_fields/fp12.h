@@ -7,7 +7,11 @@
 #define TACHYON_MATH_FINITE_FIELDS_FP12_H_
 
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/math/base/bit_iterator.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
 #include "tachyon/math/finite_fields/quadratic_extension_field.h"
 
@@ -237,6 +241,168 @@ class Fp12 final : public QuadraticExtensionField<Fp12<Config>> {
     }
   }
 
+  // Compressed cyclotomic squaring.
+  // See Squaring in Cyclotomic Subgroups - Koray Karabina
+  // https://eprint.iacr.org/2010/542.pdf
+  //
+  // An element g = g₀ + g₁x + g₂x² + (g₃ + g₄x + g₅x²)y in the cyclotomic
+  // subgroup is determined by C(g) = (g₁, g₂, g₃, g₅), and C(g²) can be
+  // computed from C(g) with 6 Fp2 squarings. Only g₁, g₂, g₃ and g₅ are
+  // updated, so |DecompressInPlace()| must be called before using the result
+  // as an ordinary Fp12 element.
+  Fp12& CompressedCyclotomicSquareInPlace() {
+    Fp2& g1 = this->c0_.c1_;
+    Fp2& g2 = this->c0_.c2_;
+    Fp2& g3 = this->c1_.c0_;
+    Fp2& g5 = this->c1_.c2_;
+
+    // t₀ = g₁²
+    Fp2 t0 = g1.Square();
+    // t₁ = g₅²
+    Fp2 t1 = g5.Square();
+    // g₁g₅ = ((g₁ + g₅)² - g₁² - g₅²) / 2
+    // t₂ = 2g₁g₅q
+    Fp2 t2 = (g1 + g5).SquareInPlace();
+    t2 -= t0;
+    t2 -= t1;
+    t2 = Fp6::Config::MulByNonResidue(t2);
+    // t₃ = g₂²
+    Fp2 t3 = g2.Square();
+    // t₄ = g₃²
+    Fp2 t4 = g3.Square();
+    // t₅ = 2g₂g₃ = (g₂ + g₃)² - g₂² - g₃²
+    Fp2 t5 = (g2 + g3).SquareInPlace();
+    t5 -= t3;
+    t5 -= t4;
+
+    // g₃' = 3 * 2g₁g₅q + 2g₃
+    //     = 2 * (2g₁g₅q + g₃) + 2g₁g₅q
+    g3 += t2;
+    g3.DoubleInPlace();
+    g3 += t2;
+
+    // g₂' = 3 * (g₁² + g₅²q) - 2g₂
+    //     = 2 * (g₁² + g₅²q - g₂) + (g₁² + g₅²q)
+    Fp2 tmp = t0 + Fp6::Config::MulByNonResidue(t1);
+    g2 = tmp - g2;
+    g2.DoubleInPlace();
+    g2 += tmp;
+
+    // g₁' = 3 * (g₃² + g₂²q) - 2g₁
+    //     = 2 * (g₃² + g₂²q - g₁) + (g₃² + g₂²q)
+    tmp = t4 + Fp6::Config::MulByNonResidue(t3);
+    g1 = tmp - g1;
+    g1.DoubleInPlace();
+    g1 += tmp;
+
+    // g₅' = 3 * 2g₂g₃ + 2g₅
+    //     = 2 * (2g₂g₃ + g₅) + 2g₂g₃
+    g5 += t5;
+    g5.DoubleInPlace();
+    g5 += t5;
+    return *this;
+  }
+
+  // Recovers g₀ and g₄ from C(g) = (g₁, g₂, g₃, g₅).
+  //
+  //   g₄ = (g₅²q + 3g₁² - 2g₂) / 4g₃ if g₃ ≠ 0
+  //   g₄ = 2g₁g₅ / g₂                otherwise
+  //   g₀ = (2g₄² + g₃g₅ - 3g₁g₂)q + 1
+  //
+  // If g₂ = g₃ = 0, then g is 1.
+  Fp12& DecompressInPlace() {
+    BatchDecompressInPlace(absl::MakeSpan(this, 1));
+    return *this;
+  }
+
+  // Same as |DecompressInPlace()| for every element of |values|, but the
+  // inversions of the denominators of g₄ are shared by Montgomery's trick.
+  static void BatchDecompressInPlace(absl::Span<Fp12> values) {
+    std::vector<Fp2> numerators(values.size());
+    std::vector<Fp2> denominators(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      const Fp2& g1 = values[i].c0_.c1_;
+      const Fp2& g2 = values[i].c0_.c2_;
+      const Fp2& g3 = values[i].c1_.c0_;
+      const Fp2& g5 = values[i].c1_.c2_;
+      if (g3.IsZero()) {
+        // 2g₁g₅ / g₂
+        numerators[i] = g1 * g5;
+        numerators[i].DoubleInPlace();
+        // NOTE: If g₂ is zero as well, the denominator is left as zero, which
+        // is skipped by |BatchInverseInPlaceSerial()|.
+        denominators[i] = g2;
+      } else {
+        // (g₅²q + 3g₁² - 2g₂) / 4g₃
+        Fp2 g1_square = g1.Square();
+        Fp2 tmp = g1_square - g2;
+        tmp.DoubleInPlace();
+        tmp += g1_square;
+        numerators[i] = Fp6::Config::MulByNonResidue(g5.Square());
+        numerators[i] += tmp;
+        denominators[i] = g3.Double();
+        denominators[i].DoubleInPlace();
+      }
+    }
+    CHECK(Fp2::BatchInverseInPlaceSerial(denominators));
+
+    for (size_t i = 0; i < values.size(); ++i) {
+      Fp12& value = values[i];
+      if (denominators[i].IsZero()) {
+        value = Fp12::One();
+        continue;
+      }
+      const Fp2& g1 = value.c0_.c1_;
+      const Fp2& g2 = value.c0_.c2_;
+      const Fp2& g3 = value.c1_.c0_;
+      const Fp2& g5 = value.c1_.c2_;
+      Fp2& g0 = value.c0_.c0_;
+      Fp2& g4 = value.c1_.c1_;
+
+      g4 = numerators[i] * denominators[i];
+
+      // g₀ = (2g₄² + g₃g₅ - 3g₁g₂)q + 1
+      //    = (2 * (g₄² - g₁g₂) - g₁g₂ + g₃g₅)q + 1
+      Fp2 g1g2 = g1 * g2;
+      Fp2 tmp = g4.Square();
+      tmp -= g1g2;
+      tmp.DoubleInPlace();
+      tmp -= g1g2;
+      tmp += g3 * g5;
+      g0 = Fp6::Config::MulByNonResidue(tmp);
+      g0 += Fp2::One();
+    }
+  }
+
+  // Return f^|exponent|, where f is an element of the cyclotomic subgroup.
+  // f^(2ⁱ) are computed with |CompressedCyclotomicSquareInPlace()| and only
+  // the ones for the set bits of |exponent| are decompressed, all at once.
+  template <size_t N>
+  [[nodiscard]] Fp12 CompressedCyclotomicPow(const BigInt<N>& exponent) const {
+    if constexpr (BasePrimeField::Config::kModulusModSixIsOne) {
+      if (exponent.IsZero()) return Fp12::One();
+
+      auto it = BitIteratorLE<BigInt<N>>::begin(&exponent);
+      auto end = BitIteratorLE<BigInt<N>>::end(&exponent, true);
+      Fp12 ret = *it ? *this : Fp12::One();
+      std::vector<Fp12> compressed;
+      Fp12 g = *this;
+      for (++it; it != end; ++it) {
+        g.CompressedCyclotomicSquareInPlace();
+        if (*it) {
+          compressed.push_back(g);
+        }
+      }
+      BatchDecompressInPlace(absl::MakeSpan(compressed));
+      for (const Fp12& value : compressed) {
+        ret *= value;
+      }
+      return ret;
+    } else {
+      return this->CyclotomicPow(exponent);
+    }
+  }
+
   // Return α = (α₀', α₁', α₂', α₃', α₄', α₅'), such that
   // α = (α₀ + α₁x + α₂x² + (α₃ + α₄x + α₅x²)y) * (β₀ + β₃y + β₄xy)
   Fp12& MulInPlaceBy034(const Fp2& beta0, const Fp2& beta3, const Fp2& beta4) {
@@ -17,6 +17,38 @@ TEST_F(Fp12Test, TypeTest) {
   EXPECT_TRUE((std::is_same_v<bn254::Fq12::BasePrimeField, bn254::Fq>));
 }
 
+TEST_F(Fp12Test, CompressedCyclotomicSquare) {
+  using F = bn254::Fq12;
+
+  // Maps a random element into the cyclotomic subgroup by raising it to
+  // (p⁶ - 1)(p² + 1).
+  F f = F::Random();
+  F g = f.CyclotomicInverse() * f.Inverse();
+  F g_frobenius = g;
+  g *= g_frobenius.FrobeniusMapInPlace(2);
+
+  F compressed = g;
+  EXPECT_EQ(compressed.DecompressInPlace(), g);
+
+  compressed = g;
+  compressed.CompressedCyclotomicSquareInPlace();
+  EXPECT_EQ(compressed.DecompressInPlace(), g.Square());
+
+  compressed = g;
+  for (size_t i = 0; i < 10; ++i) {
+    compressed.CompressedCyclotomicSquareInPlace();
+  }
+  F expected = g;
+  for (size_t i = 0; i < 10; ++i) {
+    expected.SquareInPlace();
+  }
+  EXPECT_EQ(compressed.DecompressInPlace(), expected);
+
+  BigInt<1> exponent(UINT64_C(0x44e992b44a6909f1));
+  EXPECT_EQ(g.CompressedCyclotomicPow(exponent), g.CyclotomicPow(exponent));
+  EXPECT_TRUE(g.CompressedCyclotomicPow(BigInt<1>(0)).IsOne());
+}
+
 TEST_F(Fp12Test, Copyable) {
   using F = bn254::Fq12;
 
@@ -17,6 +17,29 @@ TEST_F(Fp2Test, TypeTest) {
   EXPECT_TRUE((std::is_same_v<bn254::Fq2::BasePrimeField, bn254::Fq>));
 }
 
+TEST_F(Fp2Test, SquareRoot) {
+  using F = bn254::Fq2;
+
+  for (size_t i = 0; i < 10; ++i) {
+    F a = F::Random();
+    F sqr = a.Square();
+    F sqrt;
+    ASSERT_TRUE(sqr.SquareRoot(&sqrt));
+    EXPECT_EQ(sqrt.Square(), sqr);
+
+    // a² * (9 + u) is a quadratic non-residue, since 9 + u is.
+    F b = sqr * F(bn254::Fq(9), bn254::Fq::One());
+    EXPECT_FALSE(b.SquareRoot(&sqrt));
+  }
+
+  // The elements in the base field are quadratic residues.
+  for (const bn254::Fq& c0 : {bn254::Fq(3), -bn254::Fq(3)}) {
+    F sqrt;
+    ASSERT_TRUE(F(c0, bn254::Fq::Zero()).SquareRoot(&sqrt));
+    EXPECT_EQ(sqrt.Square(), F(c0, bn254::Fq::Zero()));
+  }
+}
+
 TEST_F(Fp2Test, Copyable) {
   using F = bn254::Fq2;
 
@@ -21,6 +21,7 @@ struct ModulusInfo {
   mpz_class r3;
   uint64_t inverse64;
   uint32_t inverse32;
+  uint64_t inverse62;
 
   template <size_t N>
   static ModulusInfo From(const mpz_class& m_in) {
@@ -39,6 +40,8 @@ struct ModulusInfo {
     math::gmp::WriteLimbs(r3.limbs, N, &ret.r3);
     ret.inverse64 = math::Modulus<N>::template Inverse<uint64_t>(m);
     ret.inverse32 = math::Modulus<N>::template Inverse<uint32_t>(m);
+    // NOTE: |inverse64| is -m⁻¹ mod 2⁶⁴, while the safegcd wants m⁻¹ mod 2⁶².
+    ret.inverse62 = (-ret.inverse64) & ((uint64_t{1} << 62) - 1);
     return ret;
   }
 
@@ -129,6 +132,7 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  });",
       "  constexpr static uint64_t kInverse64 = UINT64_C(%{inverse64});",
       "  constexpr static uint32_t kInverse32 = %{inverse32};",
+      "  constexpr static uint64_t kModulusInverse62 = UINT64_C(%{inverse62});",
       "",
       "  constexpr static BigInt<%{n}> kOne = BigInt<%{n}>({",
       "    %{one_mont_form}",
@@ -300,6 +304,7 @@ int GenerationConfig::GenerateConfigHdr() const {
           {"%{r3}", math::MpzClassToString(modulus_info.r3)},
           {"%{inverse64}", base::NumberToString(modulus_info.inverse64)},
           {"%{inverse32}", base::NumberToString(modulus_info.inverse32)},
+          {"%{inverse62}", base::NumberToString(modulus_info.inverse62)},
           {"%{one_mont_form}", math::MpzClassToMontString(mpz_class(1), m)},
       });
   return WriteHdr(content, false);
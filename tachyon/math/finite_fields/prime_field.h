@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <optional>
 #include <string>
 
 #include "gtest/gtest_prod.h"
@@ -17,6 +18,7 @@
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/base/safe_gcd.h"
 #include "tachyon/math/finite_fields/modulus.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
@@ -241,9 +243,21 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   }
 
   constexpr PrimeField& InverseInPlace() {
-    value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
-        Config::kModulus, Config::kMontgomeryR2);
-    return *this;
+    // NOTE: The inverse of aR is a⁻¹R⁻¹, so the Montgomery multiplication by
+    // R³ gives a⁻¹R.
+    value_ = kSafeGcd.Inverse(value_);
+    return MulInPlace(PrimeField::FromMontgomery(Config::kMontgomeryR3));
+  }
+
+  // PrimeFieldBase methods
+  LegendreSymbol Legendre() const {
+    if (IsZero()) return LegendreSymbol::kZero;
+    // NOTE: R = 2⁶⁴ᴺ is a square, so the symbol of aR is the one of a.
+    std::optional<int> jacobi = kSafeGcd.Jacobi(value_);
+    if (!jacobi.has_value()) {
+      return PrimeFieldBase<PrimeField>::Legendre();
+    }
+    return *jacobi == 1 ? LegendreSymbol::kOne : LegendreSymbol::kMinusOne;
   }
 
  private:
@@ -284,6 +298,9 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     return *this;
   }
 
+  constexpr static SafeGcd<N> kSafeGcd =
+      SafeGcd<N>(Config::kModulus, Config::kModulusInverse62);
+
   BigInt<N> value_;
 };
 
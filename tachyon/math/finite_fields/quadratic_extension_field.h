@@ -69,6 +69,42 @@ class QuadraticExtensionField
     return c0_.Square() - Config::MulByNonResidue(c1_.Square());
   }
 
+  // Returns true and populates |ret| with a square root if |this| is a
+  // quadratic residue. This needs |BaseField| to be of p ≡ 3 (mod 4) and the
+  // non-residue to be -1, where a square root of a = a₀ + a₁u is x₀ + x₁u
+  // with x₀² = (a₀ ± √N(a)) / 2 and x₁ = a₁ / (2x₀). This takes at most 3
+  // square roots over |BaseField| instead of an exponentiation over
+  // |Derived|.
+  // See https://eprint.iacr.org/2012/685.pdf (page 15, algorithm 8)
+  constexpr bool SquareRoot(Derived* ret) const {
+    static_assert(BaseField::Config::kModulusModFourIsThree &&
+                  Config::kNonResidueIsMinusOne);
+    if (c1_.IsZero()) {
+      // Either a₀ or -a₀ is a quadratic residue, since -1 is not.
+      BaseField x;
+      if (c0_.SquareRoot(&x)) {
+        *ret = {std::move(x), BaseField::Zero()};
+        return true;
+      }
+      if (!(-c0_).SquareRoot(&x)) return false;
+      *ret = {BaseField::Zero(), std::move(x)};
+      return true;
+    }
+
+    BaseField alpha;
+    if (!Norm().SquareRoot(&alpha)) return false;
+    BaseField two_inv = BaseField(2).Inverse();
+    BaseField delta = (c0_ + alpha) * two_inv;
+    BaseField x0;
+    if (!delta.SquareRoot(&x0)) {
+      delta = (c0_ - alpha) * two_inv;
+      if (!delta.SquareRoot(&x0)) return false;
+    }
+    BaseField x1 = c1_ * (x0.Double().Inverse());
+    *ret = {std::move(x0), std::move(x1)};
+    return true;
+  }
+
   constexpr Derived& FrobeniusMapInPlace(uint64_t exponent) {
     c0_.FrobeniusMapInPlace(exponent);
     c1_.FrobeniusMapInPlace(exponent);
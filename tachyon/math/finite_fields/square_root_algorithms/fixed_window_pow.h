@@ -0,0 +1,74 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_FIXED_WINDOW_POW_H_
+#define TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_FIXED_WINDOW_POW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// Raises elements to a fixed exponent with 4-bit windows. The windows of the
+// exponent are computed once, so that every exponentiation by it costs a
+// squaring per bit and a multiplication per non-zero window instead of a
+// multiplication per set bit.
+//
+//   FixedWindowPow<F> pow(F::Config::kModulusPlusOneDivFour);
+//   F sqrt = pow.Pow(a);
+template <typename F>
+class FixedWindowPow {
+ public:
+  constexpr static size_t kWindowBits = 4;
+  constexpr static size_t kTableSize = size_t{1} << kWindowBits;
+
+  template <size_t N>
+  explicit FixedWindowPow(const BigInt<N>& exponent) {
+    size_t num_bits = 0;
+    for (size_t i = 0; i < N * 64; ++i) {
+      if (GetBit(exponent, i)) num_bits = i + 1;
+    }
+    size_t num_windows = (num_bits + kWindowBits - 1) / kWindowBits;
+    // The most significant window comes first.
+    windows_.resize(num_windows);
+    for (size_t i = 0; i < num_windows; ++i) {
+      uint8_t window = 0;
+      for (size_t j = 0; j < kWindowBits; ++j) {
+        size_t bit = i * kWindowBits + j;
+        if (bit < N * 64 && GetBit(exponent, bit)) window |= uint8_t{1} << j;
+      }
+      windows_[num_windows - 1 - i] = window;
+    }
+  }
+
+  F Pow(const F& base) const {
+    if (windows_.empty()) return F::One();
+    F table[kTableSize];
+    table[0] = F::One();
+    table[1] = base;
+    for (size_t i = 2; i < kTableSize; ++i) {
+      table[i] = (i % 2 == 0) ? table[i / 2].Square() : table[i - 1] * base;
+    }
+    F ret = table[windows_[0]];
+    for (size_t i = 1; i < windows_.size(); ++i) {
+      for (size_t j = 0; j < kWindowBits; ++j) {
+        ret.SquareInPlace();
+      }
+      if (windows_[i] != 0) ret *= table[windows_[i]];
+    }
+    return ret;
+  }
+
+ private:
+  template <size_t N>
+  static bool GetBit(const BigInt<N>& value, size_t index) {
+    return (value[index / 64] >> (index % 64)) & 1;
+  }
+
+  std::vector<uint8_t> windows_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_FIXED_WINDOW_POW_H_
@@ -0,0 +1,176 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_SARKAR_H_
+#define TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_SARKAR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/fixed_window_pow.h"
+
+namespace tachyon::math {
+
+// The square root of Sarkar with lookup tables for a prime field whose
+// modulus M is 2ˢ * T + 1 with a large two adicity s.
+// See https://eprint.iacr.org/2020/1407.pdf
+//
+// Like Tonelli-Shanks, it reduces a square root of a to the discrete log of
+// b = aᵀ, which is in the subgroup of order 2ˢ generated by g = cᵀ, where c
+// is a non quadratic residue. Instead of finding the discrete log bit by bit
+// with O(s²) squarings, it finds it in windows of k bits from the least
+// significant one, looking each of them up in a table of the 2ᵏ-th roots of
+// unity. That takes s - k squarings and about (s / k)² / 2 multiplications.
+template <typename F>
+class SarkarSquareRoot {
+ public:
+  using Config = typename F::Config;
+  using BigIntTy = decltype(std::declval<F>().ToBigInt());
+
+  constexpr static uint32_t kTwoAdicity = Config::kTwoAdicity;
+
+  // Returns the largest divisor of |two_adicity| that is not greater than 9,
+  // which keeps every table within 2⁹ elements.
+  constexpr static uint32_t ComputeWindowBits(uint32_t two_adicity) {
+    for (uint32_t k = 9; k > 1; --k) {
+      if (two_adicity % k == 0) return k;
+    }
+    return 1;
+  }
+
+  // The number of bits of a window, which is k.
+  constexpr static uint32_t kWindowBits = ComputeWindowBits(kTwoAdicity);
+  constexpr static uint32_t kNumWindows = kTwoAdicity / kWindowBits;
+  constexpr static size_t kTableSize = size_t{1} << kWindowBits;
+  // NOTE: With smaller windows, the tables don't save enough over the plain
+  // Tonelli-Shanks.
+  constexpr static bool kIsEnabled = kWindowBits >= 4 && kTwoAdicity <= 64;
+
+  SarkarSquareRoot()
+      : trace_minus_one_div_two_pow_(Config::kTraceMinusOneDivTwo) {
+    static_assert(kIsEnabled);
+    F g = F::FromMontgomery(Config::kTwoAdicRootOfUnity);
+    F g_inv = g.Inverse();
+
+    // |inverse_powers_[l * 2ᵏ + j]| = g^(-j * 2ᵏˡ).
+    inverse_powers_.resize(kNumWindows * kTableSize);
+    F base = g_inv;
+    for (size_t l = 0; l < kNumWindows; ++l) {
+      F power = F::One();
+      for (size_t j = 0; j < kTableSize; ++j) {
+        inverse_powers_[l * kTableSize + j] = power;
+        power *= base;
+      }
+      // base = g^(-2ᵏ⁽ˡ⁺¹⁾)
+      base = power;
+    }
+
+    // ω = g^(2ˢ⁻ᵏ) is a primitive 2ᵏ-th root of unity.
+    F omega = g;
+    for (size_t i = 0; i < kTwoAdicity - kWindowBits; ++i) {
+      omega.SquareInPlace();
+    }
+    logs_.reserve(kTableSize);
+    F power = F::One();
+    for (uint32_t j = 0; j < kTableSize; ++j) {
+      logs_.push_back({power.ToBigInt(), j});
+      power *= omega;
+    }
+    std::sort(logs_.begin(), logs_.end());
+  }
+
+  static const SarkarSquareRoot& GetInstance() {
+    static base::NoDestructor<SarkarSquareRoot> instance;
+    return *instance;
+  }
+
+  const FixedWindowPow<F>& trace_minus_one_div_two_pow() const {
+    return trace_minus_one_div_two_pow_;
+  }
+
+  // Finds x such that x² = |a|, given w = a^((T - 1) / 2).
+  bool Compute(const F& a, const F& w, F* ret) const {
+    if (a.IsZero()) {
+      *ret = F::Zero();
+      return true;
+    }
+    // x = aw = a^((T + 1) / 2)
+    F x = w * a;
+    // b = xw = aᵀ = gᵉ, and x² = ab.
+    F b = x * w;
+
+    // |b_powers[i]| = b^(2ᵏ⁽ⁿ⁻¹⁻ⁱ⁾), where n is the number of windows.
+    F b_powers[kNumWindows];
+    b_powers[kNumWindows - 1] = b;
+    for (size_t i = kNumWindows - 1; i > 0; --i) {
+      F power = b_powers[i];
+      for (size_t j = 0; j < kWindowBits; ++j) {
+        power.SquareInPlace();
+      }
+      b_powers[i - 1] = std::move(power);
+    }
+
+    // Let e = Σ eᵢ * 2ᵏⁱ. Then b^(2ᵏ⁽ⁿ⁻¹⁻ⁱ⁾) = Π g^(eₗ * 2ᵏ⁽ⁿ⁻¹⁻ⁱ⁺ˡ⁾), where
+    // the terms of l > i vanish and the term of l = i is ω^(eᵢ). So eᵢ is
+    // the discrete log of b^(2ᵏ⁽ⁿ⁻¹⁻ⁱ⁾) times the inverses of the terms of
+    // l < i, which are all in the tables.
+    uint64_t e = 0;
+    uint32_t digits[kNumWindows];
+    for (size_t i = 0; i < kNumWindows; ++i) {
+      F gamma = b_powers[i];
+      for (size_t l = 0; l < i; ++l) {
+        gamma *= GetInversePower(kNumWindows - 1 - i + l, digits[l]);
+      }
+      if (!FindLog(gamma, &digits[i])) return false;
+      e |= uint64_t{digits[i]} << (kWindowBits * i);
+    }
+
+    // a is a quadratic residue if and only if e is even, and then
+    // (x * g^(-e / 2))² = x² * g⁻ᵉ = ab * b⁻¹ = a.
+    if (e % 2 != 0) return false;
+    e >>= 1;
+    for (size_t l = 0; l < kNumWindows; ++l) {
+      uint32_t digit = (e >> (kWindowBits * l)) & (kTableSize - 1);
+      if (digit != 0) x *= GetInversePower(l, digit);
+    }
+    DCHECK_EQ(x.Square(), a);
+    *ret = std::move(x);
+    return true;
+  }
+
+ private:
+  const F& GetInversePower(size_t window, uint32_t digit) const {
+    return inverse_powers_[window * kTableSize + digit];
+  }
+
+  // Returns false if |root| isn't a 2ᵏ-th root of unity.
+  bool FindLog(const F& root, uint32_t* log) const {
+    BigIntTy key = root.ToBigInt();
+    auto it = std::lower_bound(
+        logs_.begin(), logs_.end(), key,
+        [](const std::pair<BigIntTy, uint32_t>& entry, const BigIntTy& key) {
+          return entry.first < key;
+        });
+    if (it == logs_.end() || it->first != key) return false;
+    *log = it->second;
+    return true;
+  }
+
+  FixedWindowPow<F> trace_minus_one_div_two_pow_;
+  std::vector<F> inverse_powers_;
+  // The pairs of ωʲ and j sorted by ωʲ.
+  std::vector<std::pair<BigIntTy, uint32_t>> logs_;
+};
+
+template <typename F>
+bool ComputeSarkarSquareRoot(const F& a, F* ret) {
+  const SarkarSquareRoot<F>& sarkar = SarkarSquareRoot<F>::GetInstance();
+  return sarkar.Compute(a, sarkar.trace_minus_one_div_two_pow().Pow(a), ret);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_SARKAR_H_
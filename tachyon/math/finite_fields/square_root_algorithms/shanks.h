@@ -8,10 +8,21 @@
 
 #include <utility>
 
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/fixed_window_pow.h"
+
 namespace tachyon::math {
 
+// Returns the power to (p + 1) / 4, which is shared by every square root.
+template <typename F>
+const FixedWindowPow<F>& GetShanksPow() {
+  static base::NoDestructor<FixedWindowPow<F>> pow(
+      F::Config::kModulusPlusOneDivFour);
+  return *pow;
+}
+
 template <typename F>
-constexpr bool ComputeShanksSquareRoot(const F& a, F* ret) {
+bool ComputeShanksSquareRoot(const F& a, F* ret) {
   // https://eprint.iacr.org/2012/685.pdf (page 9, algorithm 2)
   // clang-format off
   // a² = b
@@ -19,7 +30,7 @@ constexpr bool ComputeShanksSquareRoot(const F& a, F* ret) {
   //    = b^(p+1) (since b^(p-1) = 1, See https://en.wikipedia.org/wiki/Fermat%27s_little_theorem)
   // a  = b^((p + 1) / 4)
   // clang-format on
-  F sqrt = a.Pow(F::Config::kModulusPlusOneDivFour);
+  F sqrt = GetShanksPow<F>().Pow(a);
   if (sqrt.Square() == a) {
     *ret = std::move(sqrt);
     return true;
@@ -10,6 +10,8 @@
 #include "third_party/eigen3/Eigen/SparseCore"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/ranges/algorithm.h"
 #include "tachyon/base/strings/string_util.h"
 
@@ -228,6 +230,7 @@ class CSRSparseMatrix {
     return matrix.ToCSR();
   }
 
+  const Elements& elements() const { return elements_; }
   const std::vector<size_t>& row_ptrs() const { return row_ptrs_; }
 
   std::vector<T> GetData() const {
@@ -284,6 +287,30 @@ class CSRSparseMatrix {
     return base::ranges::is_sorted(row_ptrs_);
   }
 
+  // Computes the sparse matrix-vector product |this| * |vector| and writes it
+  // to the first |MaxRows()| entries of |result|. The rest of |result| is left
+  // untouched, which allows the product to be written directly into a buffer
+  // sized for an evaluation domain. Rows are independent, so they are
+  // computed in parallel.
+  void MulVector(absl::Span<const T> vector, absl::Span<T> result) const {
+    size_t rows = MaxRows();
+    CHECK_GE(result.size(), rows);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < rows; ++i) {
+      T sum = T::Zero();
+      for (size_t j = row_ptrs_[i]; j < row_ptrs_[i + 1]; ++j) {
+        const Element& element = elements_[j];
+        sum += element.value * vector[element.index];
+      }
+      result[i] = std::move(sum);
+    }
+  }
+
+  std::vector<T> MulVector(absl::Span<const T> vector) const {
+    std::vector<T> ret(MaxRows());
+    MulVector(vector, absl::MakeSpan(ret));
+    return ret;
+  }
+
   // NOTE: Returns a valid value when |this| is sorted.
   ELLSparseMatrix<T> ToELL() const {
     using ELLElements = typename ELLSparseMatrix<T>::Elements;
@@ -164,6 +164,25 @@ TEST_F(SparseMatrixTest, CSRSparseMatrixGetXXX) {
   }
 }
 
+TEST_F(SparseMatrixTest, CSRSparseMatrixMulVector) {
+  std::vector<GF7> vector = {GF7(1), GF7(2), GF7(3), GF7(4), GF7(5), GF7(6)};
+  // clang-format off
+  std::vector<GF7> answers[] = {
+    // [1 * 4, 2 * 5 + 3 * 6, 4 * 1 + 5 * 2, 6 * 3]
+    {GF7(4), GF7(0), GF7(0), GF7(4)},
+  };
+  // clang-format on
+  for (size_t i = 0; i < csr_matrices_.size(); ++i) {
+    EXPECT_EQ(csr_matrices_[i].MulVector(vector), answers[i]);
+
+    std::vector<GF7> result(csr_matrices_[i].MaxRows() + 1, GF7(1));
+    csr_matrices_[i].MulVector(vector, absl::MakeSpan(result));
+    std::vector<GF7> expected = answers[i];
+    expected.push_back(GF7(1));
+    EXPECT_EQ(result, expected);
+  }
+}
+
 TEST_F(SparseMatrixTest, CSRSparseMatrixToELL) {
   for (size_t i = 0; i < csr_matrices_.size(); ++i) {
     EXPECT_EQ(csr_matrices_[i].ToELL(), ell_matrices_[i]);
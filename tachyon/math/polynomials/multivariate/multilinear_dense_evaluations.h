@@ -13,10 +13,12 @@
 #include <vector>
 
 #include "absl/hash/hash.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/bits.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/math/polynomials/multivariate/support_poly_operators.h"
 
@@ -108,59 +110,121 @@ class MultilinearDenseEvaluations {
 
   // Fix k variables out of n variables, where k is
   // |partial_point.size()| and n is |Degree()|.
-  MultilinearDenseEvaluations FixVariables(const Point& partial_point) const {
+  MultilinearDenseEvaluations FixVariables(
+      absl::Span<const F> partial_point) const {
     size_t k = partial_point.size();
     size_t n = Degree();
     CHECK_LE(k, n);
-    std::vector<F> poly = evaluations_;
-
-    // clang-format off
-    // P(x₀, x₁) = 1(1 - x₀)(1 - x₁) + 2x₀(1 - x₁) + 3(1 - x₀)x₁ + 4x₀x₁
-    //
-    // Fixing s₀:
-    // P(s₀, x₁) = 1(1 - s₀)(1 - x₁) + 2s₀(1 - x₁) + 3(1 - s₀)x₁ + 4s₀x₁
-    //           = (1(1 - s₀) + 2s₀)(1 - x₁) + (3(1 - s₀) + 4s₀)x₁
-    //           = (left₀(1 - s₀) + right₀s₀)(1 - x₁) + (left₁(1 - s₀) + right₁s₀)x₁
-    //             (where left₀ = 1, right₀ = 2, left₁ = 3 and right₁ = 4)
-    //           = (right₀ + s₀(right₀ - left₀))(1 - x₁) + (right₁ + s₀(right₁ - left₁))x₁
-    //
-    // Fixing s₁:
-    // P(s₀, s₁) = (1 + (2 - 1)s₀)(1 - s₁) + (3 + (4 - 1)4s₀)s₁
-    //           = (left₀(1 - s₀) + right₀s₀)(1 - x₁) + (left₁(1 - s₀) + right₁s₀)x₁
-    //             (where left₀ = 1 + (2 - 1)s₀ and right₀ = (3 + (4 - 1)4s₀)
-    //           = right₀ + s₁(right₀ - left₀)
-    // clang-format on
-    for (size_t i = 1; i <= k; ++i) {
-      const F& r = partial_point[i - 1];
-      for (size_t b = 0; b < (size_t{1} << (n - i)); ++b) {
-        const F& left = poly[b << 1];
-        const F& right = poly[(b << 1) + 1];
-        poly[b] = left + r * (right - left);
-      }
+    if (k == 0) return *this;
+    if (evaluations_.size() != size_t{1} << n) {
+      return Pad().FixVariables(partial_point);
     }
-    return MultilinearDenseEvaluations(
-        std::vector<F>(poly.begin(), poly.begin() + (size_t{1} << (n - k))));
+
+    // The first round reads from |evaluations_| directly, so that |this| is
+    // not copied.
+    MultilinearDenseEvaluations ret;
+    ret.evaluations_.resize(size_t{1} << (n - 1));
+    FoldFirstVariable(evaluations_.data(), partial_point[0],
+                      ret.evaluations_.size(), ret.evaluations_.data());
+    ret.FixVariablesInPlace(partial_point.subspan(1));
+    return ret;
+  }
+
+  // Fix k variables x₀, ..., xₖ₋₁ out of n variables in place, where k is
+  // |partial_point.size()| and n is |Degree()|.
+  //
+  // clang-format off
+  // P(x₀, x₁) = 1(1 - x₀)(1 - x₁) + 2x₀(1 - x₁) + 3(1 - x₀)x₁ + 4x₀x₁
+  //
+  // Fixing s₀:
+  // P(s₀, x₁) = 1(1 - s₀)(1 - x₁) + 2s₀(1 - x₁) + 3(1 - s₀)x₁ + 4s₀x₁
+  //           = (1(1 - s₀) + 2s₀)(1 - x₁) + (3(1 - s₀) + 4s₀)x₁
+  //           = (left₀(1 - s₀) + right₀s₀)(1 - x₁) + (left₁(1 - s₀) + right₁s₀)x₁
+  //             (where left₀ = 1, right₀ = 2, left₁ = 3 and right₁ = 4)
+  //           = (left₀ + s₀(right₀ - left₀))(1 - x₁) + (left₁ + s₀(right₁ - left₁))x₁
+  //
+  // Fixing s₁:
+  // P(s₀, s₁) = (1 + (2 - 1)s₀)(1 - s₁) + (3 + (4 - 3)s₀)s₁
+  //           = left₀(1 - s₁) + right₀s₁
+  //             (where left₀ = 1 + (2 - 1)s₀ and right₀ = 3 + (4 - 3)s₀)
+  //           = left₀ + s₁(right₀ - left₀)
+  // clang-format on
+  //
+  // Each round halves the buffer. An output pairs two adjacent inputs, so a
+  // round can't be parallelized in place: a thread would overwrite what
+  // another thread still has to read. Instead, the rounds alternate between
+  // |evaluations_| and a scratch buffer of half the size, which is the only
+  // allocation.
+  void FixVariablesInPlace(absl::Span<const F> partial_point) {
+    size_t k = partial_point.size();
+    size_t n = Degree();
+    CHECK_LE(k, n);
+    if (k == 0) return;
+    // NOTE: The missing evaluations are zeros. See |operator[]|.
+    evaluations_.resize(size_t{1} << n, F::Zero());
+
+    std::vector<F> scratch(size_t{1} << (n - 1));
+    F* src = evaluations_.data();
+    F* dst = scratch.data();
+    for (size_t i = 0; i < k; ++i) {
+      FoldFirstVariable(src, partial_point[i], size_t{1} << (n - i - 1), dst);
+      std::swap(src, dst);
+    }
+    if (src == scratch.data()) {
+      evaluations_ = std::move(scratch);
+    }
+    evaluations_.resize(size_t{1} << (n - k));
   }
 
-  // Evaluate polynomial at |point|. It uses |FixVariables()| internally. The
-  // |point| is a vector in {0, 1}ᵏ in little-endian form. If the size of
-  // |point| is less than the degree of the polynomial, the remaining components
-  // of |point| are assumed to be zeros.
+  // Fix k variables xₙ₋ₖ, ..., xₙ₋₁ out of n variables in place, where k is
+  // |partial_point.size()| and n is |Degree()|. |partial_point| is in
+  // little-endian form as well, so xₙ₋₁ is fixed to |partial_point.back()|
+  // first.
+  //
+  // The last variable pairs entries that are 2ⁿ⁻¹ apart. Each round reads the
+  // two halves of the buffer sequentially and writes the lower half, so it is
+  // parallelized in place without any allocation.
+  void FixLastVariablesInPlace(absl::Span<const F> partial_point) {
+    size_t k = partial_point.size();
+    size_t n = Degree();
+    CHECK_LE(k, n);
+    if (k == 0) return;
+    // NOTE: The missing evaluations are zeros. See |operator[]|.
+    evaluations_.resize(size_t{1} << n, F::Zero());
+
+    for (size_t i = 0; i < k; ++i) {
+      size_t half = size_t{1} << (n - i - 1);
+      FoldLastVariable(evaluations_.data(), partial_point[k - i - 1], half,
+                       evaluations_.data());
+    }
+    evaluations_.resize(size_t{1} << (n - k));
+  }
+
+  // Evaluate polynomial at |point|. The |point| is a vector in {0, 1}ᵏ in
+  // little-endian form. If the size of |point| is less than the degree of the
+  // polynomial, the remaining components of |point| are assumed to be zeros.
   //
   //   MultilinearDenseEvaluations<GF7, 3> evals
   //       MultilinearDenseEvaluations<GF7, 3>::Random();
   //   GF7 a = evals.Evaluate({GF7(2), GF7(3)});
   //   GF7 b = evals.Evaluate({GF7(2), GF7(3), GF7(0)});
   //   CHECK_EQ(a, b);
-  F Evaluate(const Point& point) const {
-    CHECK_EQ(
-        point.size(),
-        static_cast<size_t>(base::bits::SafeLog2Ceiling(evaluations_.size())));
-
-    MultilinearDenseEvaluations fixed = FixVariables(point);
+  F Evaluate(absl::Span<const F> point) const {
+    size_t n = Degree();
+    CHECK_EQ(point.size(), n);
+    if (n == 0) return (*this)[0];
+    if (evaluations_.size() != size_t{1} << n) {
+      return Pad().Evaluate(point);
+    }
 
-    if (fixed.IsZero()) return F::Zero();
-    return fixed.evaluations_[0];
+    // The first round reads from |evaluations_| and the rest are folded in
+    // place by |FixLastVariablesInPlace()|.
+    MultilinearDenseEvaluations folded;
+    folded.evaluations_.resize(size_t{1} << (n - 1));
+    FoldLastVariable(evaluations_.data(), point[n - 1],
+                     folded.evaluations_.size(), folded.evaluations_.data());
+    folded.FixLastVariablesInPlace(point.subspan(0, n - 1));
+    return folded.evaluations_[0];
   }
 
   std::string ToString() const { return base::VectorToString(evaluations_); }
@@ -177,6 +241,34 @@ class MultilinearDenseEvaluations {
     return ret;
   }
 
+  // Returns a copy whose size is 2ⁿ, where n is |Degree()|.
+  MultilinearDenseEvaluations Pad() const {
+    MultilinearDenseEvaluations ret = *this;
+    ret.evaluations_.resize(size_t{1} << Degree(), F::Zero());
+    return ret;
+  }
+
+  // |dst|[b] = |src|[2b] + |r| * (|src|[2b + 1] - |src|[2b]) for b < |size|.
+  static void FoldFirstVariable(const F* src, const F& r, size_t size,
+                                F* dst) {
+    OPENMP_PARALLEL_FOR(size_t b = 0; b < size; ++b) {
+      const F& left = src[b << 1];
+      const F& right = src[(b << 1) + 1];
+      dst[b] = left + r * (right - left);
+    }
+  }
+
+  // |dst|[b] = |src|[b] + |r| * (|src|[b + |size|] - |src|[b]) for b < |size|.
+  // |dst| may be equal to |src|.
+  static void FoldLastVariable(const F* src, const F& r, size_t size,
+                               F* dst) {
+    OPENMP_PARALLEL_FOR(size_t b = 0; b < size; ++b) {
+      const F& left = src[b];
+      const F& right = src[b + size];
+      dst[b] = left + r * (right - left);
+    }
+  }
+
   std::vector<F> evaluations_;
 };
 
@@ -208,6 +208,36 @@ TEST_F(MultilinearDenseEvaluationsTest, MultiplicativeOperators) {
   }
 }
 
+TEST_F(MultilinearDenseEvaluationsTest, FixVariables) {
+  Evals evals = Evals::Random(kMaxDegree);
+  Point point =
+      base::CreateVector(kMaxDegree, []() { return GF7::Random(); });
+  GF7 expected = evals.Evaluate(point);
+  absl::Span<const GF7> point_span = point;
+
+  for (size_t k = 0; k <= kMaxDegree; ++k) {
+    absl::Span<const GF7> first = point_span.subspan(0, k);
+    absl::Span<const GF7> rest = point_span.subspan(k);
+
+    Evals fixed = evals.FixVariables(first);
+    EXPECT_EQ(fixed.evaluations().size(), size_t{1} << (kMaxDegree - k));
+    EXPECT_EQ(fixed.Evaluate(rest), expected);
+
+    Evals fixed_in_place = evals;
+    fixed_in_place.FixVariablesInPlace(first);
+    EXPECT_EQ(fixed_in_place, fixed);
+
+    absl::Span<const GF7> last = point_span.subspan(kMaxDegree - k);
+    Evals last_fixed_in_place = evals;
+    last_fixed_in_place.FixLastVariablesInPlace(last);
+    EXPECT_EQ(last_fixed_in_place.evaluations().size(),
+              size_t{1} << (kMaxDegree - k));
+    EXPECT_EQ(last_fixed_in_place.Evaluate(
+                  point_span.subspan(0, kMaxDegree - k)),
+              expected);
+  }
+}
+
 TEST_F(MultilinearDenseEvaluationsTest, Hash) {
   EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly(std::make_tuple(
       Poly(), Poly::Zero(),
@@ -0,0 +1,152 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_EC_FFT_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_EC_FFT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+
+namespace tachyon::math {
+
+// The number of points transformed by a thread through the first stages of
+// |ECFFTInPlace()| and |ECIFFTInPlace()|, where the butterflies stay within a
+// block of this size. A block of bn254 G1 points in jacobian coordinates
+// takes 96 KiB, which fits in L2.
+constexpr size_t kECFFTBlockSize = size_t{1} << 10;
+
+namespace internal {
+
+// Applies the radix-2 decimation-in-time FFT to |points| in bit-reversed
+// order with the twiddles rootᵏ, which are given by |twiddles| as big
+// integers so that they aren't converted from montgomery form for every
+// butterfly. The output is in order.
+template <typename Point, typename BigInt>
+void ECFFTHelperInPlace(const std::vector<BigInt>& twiddles,
+                        std::vector<Point>& points) {
+  size_t size = points.size();
+
+  // A butterfly of the gap g uses the twiddle rootᵏ⁽ⁿᐟ⁽²ᵍ⁾⁾, where n is
+  // |size|.
+  auto butterfly = [&twiddles, &points, size](size_t i, size_t j,
+                                              size_t gap) {
+    Point& lo = points[i + j];
+    Point& hi = points[i + j + gap];
+    Point t = j == 0 ? hi : hi.ScalarMul(twiddles[j * (size / (2 * gap))]);
+    hi = lo - t;
+    lo += t;
+  };
+
+  size_t block_size = std::min(size, kECFFTBlockSize);
+  OPENMP_PARALLEL_FOR(size_t block = 0; block < size; block += block_size) {
+    for (size_t gap = 1; gap < block_size; gap <<= 1) {
+      for (size_t i = block; i < block + block_size; i += 2 * gap) {
+        for (size_t j = 0; j < gap; ++j) {
+          butterfly(i, j, gap);
+        }
+      }
+    }
+  }
+  for (size_t gap = block_size; gap < size; gap <<= 1) {
+    OPENMP_PARALLEL_FOR(size_t k = 0; k < size / 2; ++k) {
+      size_t j = k % gap;
+      butterfly((k - j) * 2, j, gap);
+    }
+  }
+}
+
+template <typename Point>
+void BitReverseInPlace(std::vector<Point>& points) {
+  size_t size = points.size();
+  if (size == 1) return;
+  uint32_t log_size = base::bits::Log2Ceiling(size);
+  for (size_t i = 1; i < size; ++i) {
+    size_t j = base::bits::BitRev(i) >> (sizeof(size_t) * 8 - log_size);
+    if (i < j) std::swap(points[i], points[j]);
+  }
+}
+
+template <typename F>
+auto GetTwiddles(size_t size, const F& root) {
+  return base::Map(F::GetSuccessivePowers(size / 2, root),
+                   [](const F& twiddle) { return twiddle.ToBigInt(); });
+}
+
+template <typename F, size_t MaxDegree, typename Point>
+bool CheckECFFTSize(const UnivariateEvaluationDomain<F, MaxDegree>& domain,
+                    std::vector<Point>* points) {
+  if (!base::bits::IsPowerOfTwo(domain.size())) {
+    LOG(ERROR) << "The domain size is not a power of two: " << domain.size();
+    return false;
+  }
+  if (points->size() > domain.size()) {
+    LOG(ERROR) << "Too many points for the domain: " << points->size();
+    return false;
+  }
+  points->resize(domain.size(), Point::Zero());
+  return true;
+}
+
+}  // namespace internal
+
+// Replaces |points| Pⱼ with Qᵢ = Σⱼ (h * ωⁱ)ʲ * Pⱼ, where ω and h are the
+// generator and the offset of |domain|. This is the FFT of the polynomial
+// whose coefficients are |points| over the group of an elliptic curve, which
+// reuses the roots of unity of |domain| as twiddles. If there are fewer
+// points than |domain.size()|, the rest are regarded as zero. Returns false
+// if |domain| isn't of a power-of-two size.
+template <typename F, size_t MaxDegree, typename Point>
+[[nodiscard]] bool ECFFTInPlace(
+    const UnivariateEvaluationDomain<F, MaxDegree>& domain,
+    std::vector<Point>* points) {
+  if (!internal::CheckECFFTSize(domain, points)) return false;
+  std::vector<Point>& p = *points;
+  if (!domain.offset().IsOne()) {
+    std::vector<F> offset_powers =
+        F::GetSuccessivePowers(p.size(), domain.offset());
+    OPENMP_PARALLEL_FOR(size_t i = 1; i < p.size(); ++i) {
+      p[i] = p[i].ScalarMul(offset_powers[i]);
+    }
+  }
+  internal::BitReverseInPlace(p);
+  internal::ECFFTHelperInPlace(
+      internal::GetTwiddles(p.size(), domain.group_gen()), p);
+  return true;
+}
+
+// The inverse of |ECFFTInPlace()|, which replaces |points| Qᵢ with
+// Pⱼ = n⁻¹ * h⁻ʲ * Σᵢ ω⁻ⁱʲ * Qᵢ, where n is |domain.size()|. For instance,
+// this turns the monomial bases [τ⁰G, τ¹G, ..., τⁿ⁻¹G] of KZG into the
+// Lagrange bases [L₀(τ)G, L₁(τ)G, ..., Lₙ₋₁(τ)G] without knowing τ.
+template <typename F, size_t MaxDegree, typename Point>
+[[nodiscard]] bool ECIFFTInPlace(
+    const UnivariateEvaluationDomain<F, MaxDegree>& domain,
+    std::vector<Point>* points) {
+  if (!internal::CheckECFFTSize(domain, points)) return false;
+  std::vector<Point>& p = *points;
+  internal::BitReverseInPlace(p);
+  internal::ECFFTHelperInPlace(
+      internal::GetTwiddles(p.size(), domain.group_gen_inv()), p);
+  std::vector<F> scalars;
+  if (domain.offset().IsOne()) {
+    scalars = std::vector<F>(p.size(), domain.size_inv());
+  } else {
+    scalars = F::GetSuccessivePowers(p.size(), domain.offset_inv(),
+                                     domain.size_inv());
+  }
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < p.size(); ++i) {
+    p[i] = p[i].ScalarMul(scalars[i]);
+  }
+  return true;
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_EC_FFT_H_
@@ -0,0 +1,101 @@
+#include "tachyon/math/polynomials/univariate/ec_fft.h"
+
+#include <memory>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = 2 * kECFFTBlockSize - 1;
+
+using Domain = UnivariateEvaluationDomain<F, kMaxDegree>;
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+template <typename Point>
+class ECFFTTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes = testing::Types<bn254::G1JacobianPoint, bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(ECFFTTest, PointTypes);
+
+TYPED_TEST(ECFFTTest, FFT) {
+  using Point = TypeParam;
+
+  // The last size spans more than a block.
+  for (size_t size : {size_t{1}, size_t{8}, 2 * kECFFTBlockSize}) {
+    SCOPED_TRACE(absl::Substitute("size: $0", size));
+    std::unique_ptr<Domain> domain =
+        Radix2EvaluationDomain<F, kMaxDegree>::Create(size);
+    std::unique_ptr<Domain> coset = domain->GetCoset(
+        F::FromMontgomery(F::Config::kSubgroupGenerator));
+    for (const Domain* d : {domain.get(), coset.get()}) {
+      // NOTE: The coset only differs in the powers of the offset, which
+      // doesn't depend on the blocks.
+      if (d == coset.get() && size > kECFFTBlockSize) continue;
+      std::vector<F> coeffs =
+          base::CreateVector(size, []() { return F::Random(); });
+      Point generator = Point::Generator();
+      std::vector<Point> points = base::Map(
+          coeffs, [&generator](const F& coeff) { return generator * coeff; });
+      ASSERT_TRUE(ECFFTInPlace(*d, &points));
+
+      std::vector<F> evals =
+          d->FFT(Poly(UnivariateDenseCoefficients<F, kMaxDegree>(
+                     std::move(coeffs))))
+              .evaluations();
+      for (size_t i : {size_t{0}, size / 2, size - 1}) {
+        EXPECT_EQ(points[i], generator * evals[i]);
+      }
+    }
+  }
+}
+
+TYPED_TEST(ECFFTTest, IFFT) {
+  using Point = TypeParam;
+
+  for (size_t size : {size_t{1}, size_t{8}}) {
+    SCOPED_TRACE(absl::Substitute("size: $0", size));
+    std::unique_ptr<Domain> domain =
+        Radix2EvaluationDomain<F, kMaxDegree>::Create(size);
+    std::unique_ptr<Domain> coset = domain->GetCoset(
+        F::FromMontgomery(F::Config::kSubgroupGenerator));
+    for (const Domain* d : {domain.get(), coset.get()}) {
+      std::vector<Point> expected =
+          base::CreateVector(size, []() { return Point::Random(); });
+      std::vector<Point> points = expected;
+      ASSERT_TRUE(ECFFTInPlace(*d, &points));
+      ASSERT_TRUE(ECIFFTInPlace(*d, &points));
+      EXPECT_EQ(points, expected);
+    }
+  }
+}
+
+TYPED_TEST(ECFFTTest, FewerPoints) {
+  using Point = TypeParam;
+
+  std::unique_ptr<Domain> domain =
+      Radix2EvaluationDomain<F, kMaxDegree>::Create(8);
+  Point point = Point::Random();
+  std::vector<Point> points = {point};
+  ASSERT_TRUE(ECFFTInPlace(*domain, &points));
+  EXPECT_EQ(points, std::vector<Point>(8, point));
+
+  points = std::vector<Point>(9, point);
+  EXPECT_FALSE(ECFFTInPlace(*domain, &points));
+}
+
+}  // namespace tachyon::math
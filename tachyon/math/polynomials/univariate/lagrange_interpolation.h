@@ -7,16 +7,24 @@
 #ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAGRANGE_INTERPOLATION_H_
 #define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_LAGRANGE_INTERPOLATION_H_
 
+#include <stddef.h>
+
+#include <iterator>
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/base/template_util.h"
+#include "tachyon/math/polynomials/univariate/subproduct_tree.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
 namespace tachyon::math {
 
+// From this number of points on, |LagrangeInterpolate()| builds a
+// |SubproductTree| instead of expanding every Nᵢ(X), which costs O(n³).
+constexpr size_t kSubproductTreeInterpolationThreshold = 12;
+
 template <size_t MaxDegree, typename Container>
 bool LagrangeInterpolate(
     const Container& points, const Container& evals,
@@ -36,6 +44,12 @@ bool LagrangeInterpolate(
     return true;
   }
 
+  if (points.size() >= kSubproductTreeInterpolationThreshold) {
+    SubproductTree<F, MaxDegree> tree(
+        std::vector<F>(std::begin(points), std::end(points)));
+    return tree.Interpolate(absl::MakeConstSpan(evals), ret);
+  }
+
   // points = [x₀, x₁, ..., xₙ₋₁]
   // |denoms[i]| = Dᵢ = 1 / (xᵢ - x₀)(xᵢ - x₁)...(xᵢ - xₙ₋₁)
   std::vector<F> denoms = base::CreateVector(points.size(), F::One());
@@ -29,4 +29,24 @@ TEST(LagrangeInterpolationTest, LagrangeInterpolate) {
   }
 }
 
+TEST(LagrangeInterpolationTest, AroundSubproductTreeThreshold) {
+  using F = bn254::Fr;
+  F::Init();
+
+  for (size_t size : {kSubproductTreeInterpolationThreshold - 1,
+                      kSubproductTreeInterpolationThreshold}) {
+    std::vector<F> points =
+        base::CreateVector(size, []() { return F::Random(); });
+    std::vector<F> evals =
+        base::CreateVector(size, []() { return F::Random(); });
+
+    UnivariateDensePolynomial<F, 31> poly;
+    ASSERT_TRUE(LagrangeInterpolate(points, evals, &poly));
+    EXPECT_LT(poly.Degree(), size);
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(poly.Evaluate(points[i]), evals[i]);
+    }
+  }
+}
+
 }  // namespace tachyon::math
@@ -49,6 +49,8 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   constexpr static size_t kDegreeAwareFFTThresholdFactor = 1 << 2;
   // The minimum number of chunks at which root compaction is beneficial.
   constexpr static size_t kDefaultMinNumChunksForCompaction = 1 << 7;
+  // The number of butterflies a task of the work stealing thread pool runs.
+  constexpr static size_t kButterflyBlockSize = 1 << 10;
 
   enum class FFTOrder {
     // The input of the FFT must be in-order, but the output does not have to
@@ -234,6 +236,33 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       static_assert(Order == FFTOrder::kOutIn);
       fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
     }
+#if defined(TACHYON_HAS_WORK_STEALING)
+    // The k-th butterfly is the (k % |gap|)-th one of the (k / |gap|)-th
+    // chunk. The butterflies are split into blocks regardless of the chunks,
+    // so that the workers are balanced whether |gap| is small or large.
+    size_t num_butterflies = poly_or_evals.NumElements() / 2;
+    if (num_butterflies == 0) return;
+    size_t block_size = std::min(kButterflyBlockSize, num_butterflies);
+    base::ParallelFor(
+        num_butterflies / block_size,
+        [&poly_or_evals, roots, step, chunk_size, gap, block_size,
+         fn](size_t block) {
+          size_t k = block * block_size;
+          size_t end = k + block_size;
+          while (k < end) {
+            size_t i = k / gap * chunk_size;
+            size_t j = k % gap;
+            size_t j_end = std::min(gap, j + (end - k));
+            for (; j < j_end; ++j, ++k) {
+              if (j * step < roots.size()) {
+                fn(poly_or_evals.at(i + j), poly_or_evals.at(i + j + gap),
+                   roots[j * step]);
+              }
+            }
+          }
+        },
+        /*grain_size=*/1);
+#else
     OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < poly_or_evals.NumElements();
                                i += chunk_size) {
       // If the chunk is sufficiently big that parallelism helps,
@@ -245,6 +274,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
         }
       }
     }
+#endif  // defined(TACHYON_HAS_WORK_STEALING)
   }
 
   constexpr void InOutHelper(DensePoly& poly, const F& root) const {
@@ -0,0 +1,183 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_SUBPRODUCT_TREE_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_SUBPRODUCT_TREE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::math {
+
+// |SubproductTree| evaluates a polynomial at a fixed set of points and
+// interpolates values over them in O(M(n) log n), where M(n) is the cost of
+// multiplying two polynomials of degree n. Building the tree costs the same,
+// so it pays off when many polynomials share the points, e.g., the
+// polynomials opened at the same points in a batch opening.
+//
+// The leaves are the linear polynomials X - xᵢ and every inner node is the
+// product of its children. A node at level k covers the points
+// [i * 2ᵏ, min((i + 1) * 2ᵏ, n)), and when a level has an odd number of
+// nodes, the last one is carried to the next level as is. The root is the
+// vanishing polynomial Z(X) = Π(X - xᵢ).
+// See https://cr.yp.to/lineartime/multapps-20080515.pdf
+template <typename F, size_t MaxDegree>
+class SubproductTree {
+ public:
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+  using Coeffs = UnivariateDenseCoefficients<F, MaxDegree>;
+
+  // Below this number of points, a remainder is evaluated at its points
+  // directly instead of being reduced further down the tree.
+  constexpr static size_t kDirectEvaluationThreshold = 16;
+
+  SubproductTree() = default;
+  explicit SubproductTree(std::vector<F>&& points) : points_(std::move(points)) {
+    Build();
+  }
+  explicit SubproductTree(const std::vector<F>& points) : points_(points) {
+    Build();
+  }
+
+  const std::vector<F>& points() const { return points_; }
+  size_t size() const { return points_.size(); }
+
+  // Returns false if the points are not distinct. Then |Interpolate()| fails.
+  bool has_distinct_points() const { return has_distinct_points_; }
+
+  // Z(X) = (X - x₀)(X - x₁)...(X - xₙ₋₁)
+  const Poly& vanishing_poly() const { return levels_.back()[0]; }
+
+  // Returns [P(x₀), P(x₁), ..., P(xₙ₋₁)].
+  std::vector<F> Evaluate(const Poly& poly) const {
+    std::vector<F> ret(points_.size(), F::Zero());
+    if (points_.empty()) return ret;
+
+    // Rᵢ(X) = P(X) mod Mᵢ(X) has the same values as P(X) at the points that
+    // Mᵢ(X) covers.
+    size_t level = levels_.size() - 1;
+    std::vector<Poly> remainders = {poly % vanishing_poly()};
+    while (level > 0 && (size_t{1} << level) > kDirectEvaluationThreshold) {
+      const std::vector<Poly>& nodes = levels_[level - 1];
+      std::vector<Poly> next_remainders(nodes.size());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < nodes.size(); ++i) {
+        next_remainders[i] = remainders[i / 2] % nodes[i];
+      }
+      remainders = std::move(next_remainders);
+      --level;
+    }
+
+    size_t span = size_t{1} << level;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points_.size(); ++i) {
+      ret[i] = remainders[i / span].Evaluate(points_[i]);
+    }
+    return ret;
+  }
+
+  // Interpolates the polynomial P(X) of degree less than n such that
+  // P(xᵢ) = |evals[i]|. Returns false if the sizes don't match or the points
+  // are not distinct.
+  //
+  // P(X) = Σᵢ vᵢ * wᵢ * Z(X) / (X - xᵢ), where wᵢ = 1 / Z'(xᵢ). The sum is
+  // combined from the leaves to the root, where a node is
+  // Lᵢ(X) * M_r(X) + Rᵢ(X) * M_l(X) for the sums Lᵢ and Rᵢ of its children
+  // and the children M_l and M_r.
+  [[nodiscard]] bool Interpolate(absl::Span<const F> evals, Poly* ret) const {
+    if (evals.size() != points_.size()) {
+      LOG(ERROR) << "points and evals sizes don't match";
+      return false;
+    }
+    if (!has_distinct_points_) {
+      LOG(ERROR) << "points are not distinct";
+      return false;
+    }
+    if (points_.empty()) {
+      *ret = Poly::Zero();
+      return true;
+    }
+
+    std::vector<Poly> sums(points_.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points_.size(); ++i) {
+      sums[i] = Poly(Coeffs({evals[i] * weights_[i]}));
+    }
+    for (size_t level = 1; level < levels_.size(); ++level) {
+      const std::vector<Poly>& children = levels_[level - 1];
+      std::vector<Poly> next_sums(levels_[level].size());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < next_sums.size(); ++i) {
+        if (2 * i + 1 < children.size()) {
+          next_sums[i] = sums[2 * i] * children[2 * i + 1];
+          next_sums[i] += sums[2 * i + 1] * children[2 * i];
+        } else {
+          next_sums[i] = std::move(sums[2 * i]);
+        }
+      }
+      sums = std::move(next_sums);
+    }
+    *ret = std::move(sums[0]);
+    return true;
+  }
+
+ private:
+  void Build() {
+    levels_.clear();
+    if (points_.empty()) {
+      levels_.push_back({Poly::One()});
+      weights_.clear();
+      has_distinct_points_ = true;
+      return;
+    }
+
+    std::vector<Poly> leaves(points_.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points_.size(); ++i) {
+      leaves[i] = Poly(Coeffs({-points_[i], F::One()}));
+    }
+    levels_.push_back(std::move(leaves));
+    while (levels_.back().size() > 1) {
+      const std::vector<Poly>& children = levels_.back();
+      std::vector<Poly> nodes((children.size() + 1) / 2);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < nodes.size(); ++i) {
+        if (2 * i + 1 < children.size()) {
+          nodes[i] = children[2 * i] * children[2 * i + 1];
+        } else {
+          nodes[i] = children[2 * i];
+        }
+      }
+      levels_.push_back(std::move(nodes));
+    }
+
+    // wᵢ = 1 / Z'(xᵢ), which is zero if and only if xᵢ is a repeated root.
+    weights_ = Evaluate(Derivative(vanishing_poly()));
+    has_distinct_points_ =
+        std::none_of(weights_.begin(), weights_.end(),
+                     [](const F& weight) { return weight.IsZero(); });
+    if (has_distinct_points_) {
+      CHECK(F::BatchInverseInPlace(weights_));
+    }
+  }
+
+  static Poly Derivative(const Poly& poly) {
+    const std::vector<F>& coefficients = poly.coefficients().coefficients();
+    if (coefficients.size() <= 1) return Poly::Zero();
+    std::vector<F> ret(coefficients.size() - 1);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ret.size(); ++i) {
+      ret[i] = coefficients[i + 1] * F(i + 1);
+    }
+    return Poly(Coeffs(std::move(ret)));
+  }
+
+  std::vector<F> points_;
+  // |levels_[0]| are the leaves and |levels_.back()[0]| is the root.
+  std::vector<std::vector<Poly>> levels_;
+  std::vector<F> weights_;
+  bool has_distinct_points_ = true;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_SUBPRODUCT_TREE_H_
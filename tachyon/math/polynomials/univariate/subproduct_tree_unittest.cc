@@ -0,0 +1,94 @@
+#include "tachyon/math/polynomials/univariate/subproduct_tree.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = 1023;
+
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+using Tree = SubproductTree<F, kMaxDegree>;
+
+class SubproductTreeTest : public FiniteFieldTest<F> {};
+
+std::vector<F> CreateRandomPoints(size_t size) {
+  return base::CreateVector(size, []() { return F::Random(); });
+}
+
+}  // namespace
+
+TEST_F(SubproductTreeTest, VanishingPoly) {
+  for (size_t size : {1, 2, 3, 17, 100}) {
+    std::vector<F> points = CreateRandomPoints(size);
+    Tree tree(points);
+    EXPECT_EQ(tree.size(), size);
+    EXPECT_EQ(tree.vanishing_poly(), Poly::FromRoots(points));
+  }
+}
+
+TEST_F(SubproductTreeTest, Evaluate) {
+  Poly poly = Poly::Random(200);
+  // The number of points is less than, close to and greater than the number
+  // of coefficients.
+  for (size_t size : {1, 5, 16, 33, 199, 300}) {
+    std::vector<F> points = CreateRandomPoints(size);
+    Tree tree(points);
+    std::vector<F> evals = tree.Evaluate(poly);
+    ASSERT_EQ(evals.size(), size);
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(evals[i], poly.Evaluate(points[i]));
+    }
+  }
+}
+
+TEST_F(SubproductTreeTest, Interpolate) {
+  for (size_t size : {1, 2, 3, 37, 300}) {
+    std::vector<F> points = CreateRandomPoints(size);
+    std::vector<F> evals = CreateRandomPoints(size);
+    Tree tree(points);
+    ASSERT_TRUE(tree.has_distinct_points());
+
+    Poly poly;
+    ASSERT_TRUE(tree.Interpolate(evals, &poly));
+    EXPECT_LT(poly.Degree(), size);
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(poly.Evaluate(points[i]), evals[i]);
+    }
+  }
+}
+
+TEST_F(SubproductTreeTest, ReuseAcrossPolys) {
+  std::vector<F> points = CreateRandomPoints(50);
+  Tree tree(points);
+  for (size_t i = 0; i < 3; ++i) {
+    Poly poly = Poly::Random(49);
+    Poly interpolated;
+    ASSERT_TRUE(tree.Interpolate(tree.Evaluate(poly), &interpolated));
+    EXPECT_EQ(interpolated, poly);
+  }
+}
+
+TEST_F(SubproductTreeTest, InvalidInputs) {
+  std::vector<F> points = CreateRandomPoints(4);
+  points[3] = points[1];
+  Tree tree(points);
+  EXPECT_FALSE(tree.has_distinct_points());
+
+  Poly poly;
+  EXPECT_FALSE(tree.Interpolate(CreateRandomPoints(4), &poly));
+
+  Tree tree2(CreateRandomPoints(4));
+  EXPECT_FALSE(tree2.Interpolate(CreateRandomPoints(3), &poly));
+}
+
+}  // namespace tachyon::math
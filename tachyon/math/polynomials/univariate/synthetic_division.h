@@ -0,0 +1,142 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_SYNTHETIC_DIVISION_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_SYNTHETIC_DIVISION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::math {
+
+// Below this number of coefficients, |SyntheticDivideInPlace()| runs
+// serially, since the carry fix-up doubles the number of multiplications.
+constexpr size_t kParallelSyntheticDivisionThreshold = size_t{1} << 14;
+
+// Divides A(X) = aₙ₋₁Xⁿ⁻¹ + ... + a₁X + a₀, given by |coefficients|, by
+// (X - |root|) with Ruffini's rule, replaces |coefficients| with the quotient
+// and returns the remainder A(|root|).
+//
+// The quotient is given by sₖ = aₖ + root * sₖ₊₁ from sₙ = 0, where qₖ₋₁ = sₖ
+// and the remainder is s₀. The recurrence is linear, so when the coefficients
+// are split into chunks, each chunk runs it from a zero carry and adds
+// rootʲ * carry to its j-th element from the top afterwards, once the carries
+// have been passed down from the highest chunk.
+template <typename F>
+F SyntheticDivideInPlace(std::vector<F>* coefficients, const F& root) {
+  std::vector<F>& a = *coefficients;
+  if (a.empty()) return F::Zero();
+
+  size_t chunk_size =
+      base::GetNumElementsPerThread(a, kParallelSyntheticDivisionThreshold);
+  std::vector<std::pair<F, F>> chunk_results = base::ParallelizeMapByChunkSize(
+      a, chunk_size,
+      [&root](absl::Span<F> chunk) {
+        // Returns the s of the lowest element in the chunk from a zero carry
+        // and root^|chunk.size()|, which is the factor of the carry there.
+        F s = F::Zero();
+        F factor = F::One();
+        for (size_t i = chunk.size() - 1; i != SIZE_MAX; --i) {
+          s *= root;
+          s += chunk[i];
+          chunk[i] = s;
+          factor *= root;
+        }
+        return std::make_pair(std::move(s), std::move(factor));
+      });
+
+  // |carries[i]| is the s just above the i-th chunk.
+  size_t num_chunks = chunk_results.size();
+  std::vector<F> carries(num_chunks, F::Zero());
+  for (size_t i = num_chunks - 1; i > 0; --i) {
+    carries[i - 1] =
+        chunk_results[i].first + chunk_results[i].second * carries[i];
+  }
+  if (num_chunks > 1) {
+    base::ParallelizeByChunkSize(
+        a, chunk_size,
+        [&root, &carries](absl::Span<F> chunk, size_t chunk_index) {
+          if (carries[chunk_index].IsZero()) return;
+          F carry = carries[chunk_index] * root;
+          for (size_t i = chunk.size() - 1; i != SIZE_MAX; --i) {
+            chunk[i] += carry;
+            carry *= root;
+          }
+        });
+  }
+
+  F remainder = std::move(a[0]);
+  a.erase(a.begin());
+  return remainder;
+}
+
+// Returns the quotient of (P₀(X) + r * P₁(X) + ... + rᵏ⁻¹ * Pₖ₋₁(X)) divided
+// by Z(X) = (X - x₀)(X - x₁)...(X - xₘ₋₁), where Pᵢ(X) = *|polys[i]| and
+// xᵢ = |roots[i]|. The linear combination is accumulated in a single pass
+// over the coefficients and then divided by each (X - xᵢ) in
+// O(n * m), which is much cheaper than a generic long division for the
+// handful of points opened in a batch.
+//
+// NOTE: Only the quotient is returned. So when the remainders are known to
+// be Rᵢ(X), this is also the quotient of Σᵢ rⁱ * (Pᵢ(X) - Rᵢ(X)) by Z(X),
+// because deg(Rᵢ) < m.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> CombineAndDivideByVanishingPoly(
+    const std::vector<const UnivariateDensePolynomial<F, MaxDegree>*>& polys,
+    const F& r, const std::vector<F>& roots) {
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+  using Coeffs = UnivariateDenseCoefficients<F, MaxDegree>;
+
+  size_t size = 0;
+  for (const Poly* poly : polys) {
+    size = std::max(size, poly->coefficients().coefficients().size());
+  }
+  if (size <= roots.size()) return Poly::Zero();
+
+  std::vector<F> powers_of_r = F::GetSuccessivePowers(polys.size(), r);
+  std::vector<F> combined(size);
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+    F sum = F::Zero();
+    for (size_t j = 0; j < polys.size(); ++j) {
+      const std::vector<F>& coefficients =
+          polys[j]->coefficients().coefficients();
+      if (i < coefficients.size()) {
+        sum += coefficients[i] * powers_of_r[j];
+      }
+    }
+    combined[i] = std::move(sum);
+  }
+
+  for (const F& root : roots) {
+    SyntheticDivideInPlace(&combined, root);
+  }
+  return Poly(Coeffs(std::move(combined)));
+}
+
+// Returns the quotient of |poly| divided by (X - x₀)(X - x₁)...(X - xₘ₋₁),
+// where xᵢ = |roots[i]|.
+template <typename F, size_t MaxDegree>
+UnivariateDensePolynomial<F, MaxDegree> DivideByVanishingPoly(
+    UnivariateDensePolynomial<F, MaxDegree>&& poly,
+    const std::vector<F>& roots) {
+  using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+  using Coeffs = UnivariateDenseCoefficients<F, MaxDegree>;
+
+  std::vector<F>& coefficients = poly.coefficients().coefficients();
+  if (coefficients.size() <= roots.size()) return Poly::Zero();
+  for (const F& root : roots) {
+    SyntheticDivideInPlace(&coefficients, root);
+  }
+  return Poly(Coeffs(std::move(coefficients)));
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_SYNTHETIC_DIVISION_H_
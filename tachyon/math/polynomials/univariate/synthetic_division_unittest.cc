@@ -0,0 +1,73 @@
+#include "tachyon/math/polynomials/univariate/synthetic_division.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn254::Fr;
+
+constexpr size_t kMaxDegree = (size_t{1} << 16) - 1;
+
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+class SyntheticDivisionTest : public FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(SyntheticDivisionTest, SyntheticDivideInPlace) {
+  // The last size is large enough to be split into chunks.
+  for (size_t size : {size_t{1}, size_t{2}, size_t{10},
+                      kParallelSyntheticDivisionThreshold + 3}) {
+    Poly poly = Poly::Random(size - 1);
+    F root = F::Random();
+
+    std::vector<F> coefficients = poly.coefficients().coefficients();
+    F remainder = SyntheticDivideInPlace(&coefficients, root);
+    EXPECT_EQ(remainder, poly.Evaluate(root));
+    ASSERT_EQ(coefficients.size(), size - 1);
+
+    DivResult<Poly> expected =
+        poly.DivMod(Poly::FromRoots(std::vector<F>{root}));
+    EXPECT_EQ(Poly(UnivariateDenseCoefficients<F, kMaxDegree>(
+                  std::move(coefficients))),
+              expected.quotient);
+  }
+}
+
+TEST_F(SyntheticDivisionTest, DivideByVanishingPoly) {
+  std::vector<F> roots = base::CreateVector(3, []() { return F::Random(); });
+  Poly vanishing_poly = Poly::FromRoots(roots);
+
+  Poly poly = Poly::Random(100);
+  EXPECT_EQ(DivideByVanishingPoly(Poly(poly), roots), poly / vanishing_poly);
+
+  // Polynomials of a lower degree than the vanishing polynomial give zero.
+  EXPECT_TRUE(DivideByVanishingPoly(Poly::Random(2), roots).IsZero());
+}
+
+TEST_F(SyntheticDivisionTest, CombineAndDivideByVanishingPoly) {
+  std::vector<F> roots = base::CreateVector(3, []() { return F::Random(); });
+  std::vector<Poly> polys = {Poly::Random(50), Poly::Random(70),
+                             Poly::Random(2), Poly::Random(30)};
+  F r = F::Random();
+
+  std::vector<const Poly*> poly_ptrs =
+      base::Map(polys, [](const Poly& poly) { return &poly; });
+  Poly actual = CombineAndDivideByVanishingPoly(poly_ptrs, r, roots);
+
+  std::vector<Poly> combined = polys;
+  Poly& expected =
+      Poly::LinearCombinationInPlace</*forward=*/false>(combined, r);
+  expected /= Poly::FromRoots(roots);
+  EXPECT_EQ(actual, expected);
+}
+
+}  // namespace tachyon::math
@@ -2,6 +2,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -397,4 +398,81 @@ TEST_F(UnivariateDensePolynomialTest, JsonValueConverter) {
   EXPECT_EQ(json, expected_json);
 }
 
+namespace {
+
+constexpr size_t kLargeMaxDegree = 4095;
+
+template <typename F>
+class UnivariateDenseLargePolynomialTest : public FiniteFieldTest<F> {
+ public:
+  using Poly = UnivariateDensePolynomial<F, kLargeMaxDegree>;
+  using Coeffs = UnivariateDenseCoefficients<F, kLargeMaxDegree>;
+
+  static Poly SchoolbookMul(const Poly& a, const Poly& b) {
+    const std::vector<F>& a_coeffs = a.coefficients().coefficients();
+    const std::vector<F>& b_coeffs = b.coefficients().coefficients();
+    std::vector<F> coeffs(a_coeffs.size() + b_coeffs.size() - 1, F::Zero());
+    for (size_t i = 0; i < a_coeffs.size(); ++i) {
+      for (size_t j = 0; j < b_coeffs.size(); ++j) {
+        coeffs[i + j] += a_coeffs[i] * b_coeffs[j];
+      }
+    }
+    return Poly(Coeffs(std::move(coeffs)));
+  }
+};
+
+// NOTE: GF7 doesn't have large enough subgroups for NTT, so its products fall
+// back to Karatsuba.
+using FieldTypes = testing::Types<GF7, bn254::Fr>;
+TYPED_TEST_SUITE(UnivariateDenseLargePolynomialTest, FieldTypes);
+
+}  // namespace
+
+TYPED_TEST(UnivariateDenseLargePolynomialTest, Mul) {
+  using Poly = typename TestFixture::Poly;
+
+  // Covers the schoolbook, Karatsuba and NTT multiplications with balanced
+  // and unbalanced operands.
+  struct {
+    size_t a_degree;
+    size_t b_degree;
+  } tests[] = {
+      {10, 20}, {100, 70}, {300, 20}, {40, 1000}, {700, 500},
+  };
+
+  for (const auto& test : tests) {
+    Poly a = Poly::Random(test.a_degree);
+    Poly b = Poly::Random(test.b_degree);
+    Poly expected = TestFixture::SchoolbookMul(a, b);
+    EXPECT_EQ(a * b, expected);
+    EXPECT_EQ(b * a, expected);
+  }
+}
+
+TYPED_TEST(UnivariateDenseLargePolynomialTest, DivMod) {
+  using Poly = typename TestFixture::Poly;
+
+  // Covers the long division and the division by Newton iteration.
+  struct {
+    size_t a_degree;
+    size_t b_degree;
+  } tests[] = {
+      {30, 10}, {1000, 500}, {1000, 10}, {1000, 990}, {2000, 700},
+  };
+
+  for (const auto& test : tests) {
+    Poly a = Poly::Random(test.a_degree);
+    Poly b = Poly::Random(test.b_degree);
+    auto result = a.DivMod(b);
+    if (!result.remainder.IsZero()) {
+      EXPECT_LT(result.remainder.Degree(), b.Degree());
+    }
+    EXPECT_EQ(result.quotient * b + result.remainder, a);
+    // Dividing by a sparse polynomial always takes the long division.
+    EXPECT_EQ(result, a.DivMod(b.ToSparse()));
+    EXPECT_EQ(a / b, result.quotient);
+    EXPECT_EQ(a % b, result.remainder);
+  }
+}
+
 }  // namespace tachyon::math
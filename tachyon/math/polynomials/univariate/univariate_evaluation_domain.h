@@ -118,6 +118,34 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   [[nodiscard]] constexpr virtual DensePoly IFFT(const Evals& evals) const = 0;
   [[nodiscard]] constexpr virtual DensePoly IFFT(Evals&& evals) const = 0;
 
+  // Compute IFFTs of |evals_vec|. If there are at least as many of them as the
+  // threads, each thread runs whole IFFTs. Otherwise, they are run one after
+  // another, since each IFFT is parallelized by itself.
+  [[nodiscard]] std::vector<DensePoly> IFFTs(
+      std::vector<Evals>&& evals_vec) const {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    std::vector<DensePoly> polys(evals_vec.size());
+    if (thread_nums > 1 && evals_vec.size() >= thread_nums) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < evals_vec.size(); ++i) {
+        polys[i] = IFFT(std::move(evals_vec[i]));
+      }
+    } else {
+      for (size_t i = 0; i < evals_vec.size(); ++i) {
+        polys[i] = IFFT(std::move(evals_vec[i]));
+      }
+    }
+    return polys;
+  }
+
+  [[nodiscard]] std::vector<DensePoly> IFFTs(
+      const std::vector<Evals>& evals_vec) const {
+    return IFFTs(std::vector<Evals>(evals_vec));
+  }
+
   // Computes the first |size| roots of unity for the entire domain.
   // e.g. for the domain [1, g, g², ..., gⁿ⁻¹}] and |size| = n / 2, it computes
   // [1, g, g², ..., g^{(n / 2) - 1}]
@@ -6,6 +6,7 @@
 #include "absl/types/span.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/containers/contains.h"
 #include "tachyon/base/functional/function_ref.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
@@ -273,6 +274,25 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FFTCorrectness) {
   }
 }
 
+TYPED_TEST(UnivariateEvaluationDomainTest, IFFTs) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  const size_t domain_size = 32;
+  this->TestDomains(domain_size, [](const BaseDomain& d) {
+    std::vector<Evals> evals_vec =
+        base::CreateVector(5, [&d]() { return d.template Random<Evals>(); });
+    std::vector<DensePoly> polys = d.IFFTs(evals_vec);
+    ASSERT_EQ(polys.size(), evals_vec.size());
+    for (size_t i = 0; i < evals_vec.size(); ++i) {
+      EXPECT_EQ(polys[i], d.IFFT(evals_vec[i]));
+    }
+  });
+}
+
 // Test that the degree aware FFT (O(n log d)) matches the regular FFT
 // (O(n log n)).
 TYPED_TEST(UnivariateEvaluationDomainTest, DegreeAwareFFTCorrectness) {
@@ -6,11 +6,18 @@
 #ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_POLYNOMIAL_OPS_H_
 #define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_POLYNOMIAL_OPS_H_
 
+#include <stddef.h>
+
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/numeric/bits.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/arithmetics_results.h"
@@ -19,6 +26,15 @@
 namespace tachyon::math {
 namespace internal {
 
+// Whether |F| has roots of unity of order 2ᵏ, which the NTT based
+// multiplication needs.
+template <typename F, typename SFINAE = void>
+struct SupportsNTTMul : std::false_type {};
+
+template <typename F>
+struct SupportsNTTMul<F, std::enable_if_t<F::HasRootOfUnity()>>
+    : std::true_type {};
+
 template <typename F, size_t MaxDegree>
 class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
  public:
@@ -26,6 +42,18 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
   using S = UnivariateSparseCoefficients<F, MaxDegree>;
   using Term = typename S::Term;
 
+  // The product of two dense polynomials is computed by the schoolbook method
+  // if the shorter one has less than |kKaratsubaThreshold| coefficients, by
+  // Karatsuba if it has less than |kNTTMulThreshold| coefficients and by NTT
+  // otherwise. NTT falls back to Karatsuba if |F| doesn't have a root of unity
+  // of the needed order.
+  constexpr static size_t kKaratsubaThreshold = 32;
+  constexpr static size_t kNTTMulThreshold = 64;
+  // A dense polynomial is divided by Newton iteration if both the quotient and
+  // the divisor have at least |kNewtonDivisionThreshold| coefficients and by
+  // long division otherwise.
+  constexpr static size_t kNewtonDivisionThreshold = 256;
+
   static UnivariatePolynomial<D>& AddInPlace(
       UnivariatePolynomial<D>& self, const UnivariatePolynomial<D>& other) {
     std::vector<F>& l_coefficients = self.coefficients_.coefficients_;
@@ -169,21 +197,9 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
       return self;
     }
 
-    size_t degree = self.Degree();
-    size_t other_degree = other.Degree();
-    std::vector<F> coefficients =
-        base::CreateVector(degree + other_degree + 1, F::Zero());
-    for (size_t i = 0; i < r_coefficients.size(); ++i) {
-      const F& r = r_coefficients[i];
-      if (r.IsZero()) {
-        continue;
-      } else {
-        for (size_t j = 0; j < l_coefficients.size(); ++j) {
-          coefficients[i + j] += l_coefficients[j] * r;
-        }
-      }
-    }
-
+    std::vector<F> coefficients = Multiply(
+        absl::MakeConstSpan(l_coefficients).subspan(0, self.Degree() + 1),
+        absl::MakeConstSpan(r_coefficients).subspan(0, other.Degree() + 1));
     l_coefficients = std::move(coefficients);
     self.coefficients_.RemoveHighDegreeZeros();
     return self;
@@ -309,6 +325,12 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
     } else if (self.Degree() < other.Degree()) {
       return {UnivariatePolynomial<D>::Zero(), self.ToDense()};
     }
+    if constexpr (std::is_same_v<DOrS, D>) {
+      if (std::min(self.Degree() - other.Degree(), other.Degree()) + 1 >=
+          kNewtonDivisionThreshold) {
+        return NewtonDivide(self, other);
+      }
+    }
     std::vector<F> quotient =
         base::CreateVector(self.Degree() - other.Degree() + 1, F::Zero());
     UnivariatePolynomial<D> remainder = self.ToDense();
@@ -339,6 +361,210 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
     d.RemoveHighDegreeZeros();
     return {UnivariatePolynomial<D>(std::move(d)), std::move(remainder)};
   }
+
+  // Computes q(X) and r(X) such that a(X) = q(X) * b(X) + r(X), where
+  // deg(r) < deg(b), with O(M(n)) operations, where M(n) is the cost of
+  // multiplying two polynomials of degree n. Let n = deg(a), m = deg(b) and
+  // rev(f)(X) = Xᵈᵉᵍ⁽ᶠ⁾ * f(1 / X). Then
+  //
+  //   rev(q) = rev(a) * rev(b)⁻¹ mod Xⁿ⁻ᵐ⁺¹
+  //
+  // and rev(b)⁻¹ mod Xⁿ⁻ᵐ⁺¹ is obtained by Newton iteration.
+  // See https://people.csail.mit.edu/madhu/ST12/scribe/lect06.pdf
+  static DivResult<UnivariatePolynomial<D>> NewtonDivide(
+      const UnivariatePolynomial<D>& a, const UnivariatePolynomial<D>& b) {
+    const std::vector<F>& a_coefficients = a.coefficients_.coefficients_;
+    const std::vector<F>& b_coefficients = b.coefficients_.coefficients_;
+    size_t a_size = a.Degree() + 1;
+    size_t b_size = b.Degree() + 1;
+    size_t quotient_size = a_size - b_size + 1;
+
+    std::vector<F> rev_a(a_coefficients.rend() - a_size,
+                         a_coefficients.rend() - a_size + quotient_size);
+    std::vector<F> rev_b(b_coefficients.rend() - b_size,
+                         b_coefficients.rend() - b_size +
+                             std::min(b_size, quotient_size));
+    std::vector<F> rev_b_inv = InverseModXn(rev_b, quotient_size);
+    std::vector<F> rev_q = Multiply(rev_a, rev_b_inv);
+    rev_q.resize(quotient_size);
+    std::vector<F> quotient(rev_q.rbegin(), rev_q.rend());
+
+    // r = a - q * b, which only has the lower deg(b) coefficients.
+    std::vector<F> qb = Multiply(
+        quotient, absl::MakeConstSpan(b_coefficients).subspan(0, b_size));
+    std::vector<F> remainder(b_size - 1);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < remainder.size(); ++i) {
+      remainder[i] = a_coefficients[i] - qb[i];
+    }
+
+    D q(std::move(quotient));
+    q.RemoveHighDegreeZeros();
+    D r(std::move(remainder));
+    r.RemoveHighDegreeZeros();
+    return {UnivariatePolynomial<D>(std::move(q)),
+            UnivariatePolynomial<D>(std::move(r))};
+  }
+
+  // Returns f⁻¹ mod Xⁿ, where f(0) ≠ 0. Each Newton step doubles the number
+  // of correct coefficients: g' = g - g * (f * g - 1) mod X²ᵏ, where
+  // g = f⁻¹ mod Xᵏ.
+  static std::vector<F> InverseModXn(absl::Span<const F> f, size_t n) {
+    std::vector<F> g = {f[0].Inverse()};
+    size_t k = 1;
+    while (k < n) {
+      size_t next_k = std::min(2 * k, n);
+      // e = f * g - 1 mod X²ᵏ, whose lower k coefficients are zero.
+      std::vector<F> e = Multiply(f.subspan(0, std::min(next_k, f.size())), g);
+      e.resize(next_k, F::Zero());
+      std::vector<F> ge =
+          Multiply(g, absl::MakeConstSpan(e).subspan(k, next_k - k));
+      g.resize(next_k, F::Zero());
+      OPENMP_PARALLEL_FOR(size_t i = k; i < next_k; ++i) {
+        g[i] -= ge[i - k];
+      }
+      k = next_k;
+    }
+    return g;
+  }
+
+  // Returns the coefficients of the product of |a| and |b|. The algorithm is
+  // chosen by the sizes of the operands. See |kKaratsubaThreshold|.
+  static std::vector<F> Multiply(absl::Span<const F> a, absl::Span<const F> b) {
+    if (a.size() < b.size()) std::swap(a, b);
+    if (b.empty()) return {};
+    if (b.size() < kKaratsubaThreshold) return SchoolbookMul(a, b);
+    if constexpr (SupportsNTTMul<F>::value) {
+      if (b.size() >= kNTTMulThreshold) {
+        std::vector<F> ret;
+        if (NTTMul(a, b, &ret)) return ret;
+      }
+    }
+    return KaratsubaMul(a, b);
+  }
+
+  static std::vector<F> SchoolbookMul(absl::Span<const F> a,
+                                      absl::Span<const F> b) {
+    std::vector<F> ret = base::CreateVector(a.size() + b.size() - 1, F::Zero());
+    for (size_t i = 0; i < b.size(); ++i) {
+      const F& r = b[i];
+      if (r.IsZero()) continue;
+      for (size_t j = 0; j < a.size(); ++j) {
+        ret[i + j] += a[j] * r;
+      }
+    }
+    return ret;
+  }
+
+  // Splits a(X) = a₀(X) + a₁(X) * Xʰ and b(X) = b₀(X) + b₁(X) * Xʰ and computes
+  // a(X) * b(X) = z₀(X) + (z₁(X) - z₀(X) - z₂(X)) * Xʰ + z₂(X) * X²ʰ with 3
+  // half-sized products z₀ = a₀ * b₀, z₁ = (a₀ + a₁) * (b₀ + b₁) and
+  // z₂ = a₁ * b₁.
+  static std::vector<F> KaratsubaMul(absl::Span<const F> a,
+                                     absl::Span<const F> b) {
+    if (a.size() < b.size()) std::swap(a, b);
+    if (b.size() < kKaratsubaThreshold) return SchoolbookMul(a, b);
+
+    size_t h = (a.size() + 1) / 2;
+    std::vector<F> ret = base::CreateVector(a.size() + b.size() - 1, F::Zero());
+    if (b.size() <= h) {
+      // b(X) is too short to be split, so only a(X) is split.
+      AddShifted(KaratsubaMul(a.subspan(0, h), b), 0, ret);
+      AddShifted(KaratsubaMul(a.subspan(h), b), h, ret);
+      return ret;
+    }
+
+    absl::Span<const F> a0 = a.subspan(0, h);
+    absl::Span<const F> a1 = a.subspan(h);
+    absl::Span<const F> b0 = b.subspan(0, h);
+    absl::Span<const F> b1 = b.subspan(h);
+    std::vector<F> a01(a0.begin(), a0.end());
+    for (size_t i = 0; i < a1.size(); ++i) {
+      a01[i] += a1[i];
+    }
+    std::vector<F> b01(b0.begin(), b0.end());
+    for (size_t i = 0; i < b1.size(); ++i) {
+      b01[i] += b1[i];
+    }
+
+    std::vector<F> z0 = KaratsubaMul(a0, b0);
+    std::vector<F> z1 = KaratsubaMul(a01, b01);
+    std::vector<F> z2 = KaratsubaMul(a1, b1);
+    for (size_t i = 0; i < z0.size(); ++i) {
+      z1[i] -= z0[i];
+    }
+    for (size_t i = 0; i < z2.size(); ++i) {
+      z1[i] -= z2[i];
+    }
+    AddShifted(z0, 0, ret);
+    AddShifted(z1, h, ret);
+    AddShifted(z2, 2 * h, ret);
+    return ret;
+  }
+
+  // Adds |src| * Xˢʰᶦᶠᵗ to |dst|. The high coefficients of |src| that don't
+  // fit in |dst| must be zero.
+  static void AddShifted(const std::vector<F>& src, size_t shift,
+                         std::vector<F>& dst) {
+    size_t size = std::min(src.size(), dst.size() - shift);
+    for (size_t i = 0; i < size; ++i) {
+      dst[shift + i] += src[i];
+    }
+  }
+
+  // Multiplies |a| and |b| pointwise over the subgroup of order 2ᵏ, where 2ᵏ
+  // is the smallest power of 2 that is not less than the size of the
+  // product. Returns false if |F| doesn't have such a subgroup.
+  static bool NTTMul(absl::Span<const F> a, absl::Span<const F> b,
+                     std::vector<F>* ret) {
+    size_t size = a.size() + b.size() - 1;
+    size_t n = absl::bit_ceil(size);
+    F omega;
+    if (!F::GetRootOfUnity(n, &omega)) return false;
+
+    std::vector<F> a_evals(n, F::Zero());
+    std::copy(a.begin(), a.end(), a_evals.begin());
+    std::vector<F> b_evals(n, F::Zero());
+    std::copy(b.begin(), b.end(), b_evals.begin());
+    NTTInPlace(omega, a_evals);
+    NTTInPlace(omega, b_evals);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      a_evals[i] *= b_evals[i];
+    }
+
+    // The inverse NTT is an NTT with ω⁻¹ followed by a division by n.
+    NTTInPlace(omega.Inverse(), a_evals);
+    F n_inv = F(n).Inverse();
+    a_evals.resize(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      a_evals[i] *= n_inv;
+    }
+    *ret = std::move(a_evals);
+    return true;
+  }
+
+  // Iterative radix-2 Cooley-Tukey NTT. The size of |values| must be a power
+  // of 2 greater than 1 and |omega| must be a root of unity of that order.
+  static void NTTInPlace(const F& omega, std::vector<F>& values) {
+    size_t n = values.size();
+    uint32_t log_n = base::bits::Log2Floor(n);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      size_t j = base::bits::BitRev(i) >> (64 - log_n);
+      if (i < j) std::swap(values[i], values[j]);
+    }
+
+    std::vector<F> twiddles = F::GetSuccessivePowers(n / 2, omega);
+    for (size_t half = 1; half < n; half <<= 1) {
+      size_t stride = n / (2 * half);
+      OPENMP_PARALLEL_FOR(size_t k = 0; k < n / 2; ++k) {
+        size_t j = k % half;
+        size_t i0 = (k - j) * 2 + j;
+        size_t i1 = i0 + half;
+        F t = values[i1] * twiddles[j * stride];
+        values[i1] = values[i0] - t;
+        values[i0] += t;
+      }
+    }
+  }
 };
 
 template <typename F, size_t MaxDegree>
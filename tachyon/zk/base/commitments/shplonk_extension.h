@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/shplonk.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -47,6 +49,8 @@ class SHPlonkExtension final
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
   using Evals = typename Base::Evals;
+  using PairingAccumulator =
+      typename crypto::SHPlonk<Curve, MaxDegree, Commitment>::PairingAccumulator;
 
   SHPlonkExtension() = default;
   explicit SHPlonkExtension(
@@ -111,6 +115,17 @@ class SHPlonkExtension final
     return shplonk_.DoCommitLagrange(evals, state, index);
   }
 
+  [[nodiscard]] bool DoCommitLagrangeMulti(
+      absl::Span<const Evals* const> evals_list,
+      crypto::BatchCommitmentState& state, size_t index) {
+    return shplonk_.DoCommitLagrangeMulti(evals_list, state, index);
+  }
+
+  [[nodiscard]] bool DoCommitLagrangeSparse(const Evals& evals,
+                                            Commitment* out) const {
+    return shplonk_.DoCommitLagrangeSparse(evals, out);
+  }
+
   template <typename ScalarContainer>
   [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
                                       Commitment* out) const {
@@ -136,6 +151,18 @@ class SHPlonkExtension final
     return shplonk_.DoVerifyOpeningProof(poly_openings, proof);
   }
 
+  template <typename Container, typename Proof>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings, Proof* proof,
+      PairingAccumulator* accumulator) const {
+    return shplonk_.DoVerifyOpeningProof(poly_openings, proof, accumulator);
+  }
+
+  [[nodiscard]] bool VerifyPairingAccumulator(
+      const PairingAccumulator& accumulator) const {
+    return shplonk_.VerifyPairingAccumulator(accumulator);
+  }
+
  private:
   friend class c::zk::plonk::halo2::bn254::SHPlonkProverImpl;
   friend class halo2_api::bn254::SHPlonkProver;
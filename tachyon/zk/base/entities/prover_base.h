@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme_traits_forward.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
@@ -112,6 +114,18 @@ class ProverBase : public Entity<PCS> {
     CHECK(this->pcs_.CommitLagrange(evals, index));
   }
 
+  // Commits to every evals of |evals_list| at once and stores the
+  // commitments from |index|. It does nothing if |evals_list| is empty, in
+  // which case the batch mode may not be set.
+  template <typename T = PCS,
+            std::enable_if_t<crypto::VectorCommitmentSchemeTraits<
+                T>::kSupportsBatchMode>* = nullptr>
+  void BatchCommitMultiAt(absl::Span<const Evals* const> evals_list,
+                          size_t index) {
+    if (evals_list.empty()) return;
+    CHECK(this->pcs_.CommitLagrangeMulti(evals_list, index));
+  }
+
   void CommitAndWriteToTranscript(const Evals& evals) {
     Commitment commitment = Commit(evals);
     CHECK(GetWriter()->WriteToTranscript(commitment));
@@ -132,9 +146,7 @@ class ProverBase : public Entity<PCS> {
                 T>::kSupportsBatchMode>* = nullptr>
   void RetrieveAndWriteBatchCommitmentsToProof() {
     std::vector<Commitment> commitments = this->pcs_.GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      CHECK(GetWriter()->WriteToProof(commitment));
-    }
+    CHECK(GetWriter()->WriteToProof(absl::MakeConstSpan(commitments)));
   }
 
   template <typename T = PCS,
@@ -142,9 +154,8 @@ class ProverBase : public Entity<PCS> {
                 T>::kSupportsBatchMode>* = nullptr>
   void RetrieveAndWriteBatchCommitmentsToTranscript() {
     std::vector<Commitment> commitments = this->pcs_.GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      CHECK(GetWriter()->WriteToTranscript(commitment));
-    }
+    CHECK(GetWriter()->BatchWriteToTranscript(
+        absl::MakeConstSpan(commitments)));
   }
 
  protected:
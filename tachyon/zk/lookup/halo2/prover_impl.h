@@ -98,13 +98,16 @@ void Prover<Poly, Evals>::BatchCommitPermutedPairs(
   if (lookup_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
     for (const Prover& lookup_prover : lookup_provers) {
       for (const LookupPair<BlindedPolynomial<Poly, Evals>>& permuted_pair :
            lookup_prover.permuted_pairs_) {
-        prover->BatchCommitAt(permuted_pair.input().evals(), commit_idx++);
-        prover->BatchCommitAt(permuted_pair.table().evals(), commit_idx++);
+        evals_list.push_back(&permuted_pair.input().evals());
+        evals_list.push_back(&permuted_pair.table().evals());
       }
     }
+    prover->BatchCommitMultiAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const Prover& lookup_prover : lookup_provers) {
       for (const LookupPair<BlindedPolynomial<Poly, Evals>>& permuted_pair :
@@ -153,12 +156,15 @@ void Prover<Poly, Evals>::BatchCommitGrandProductPolys(
   if (lookup_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
            lookup_prover.grand_product_polys_) {
-        prover->BatchCommitAt(grand_product_poly.evals(), commit_idx++);
+        evals_list.push_back(&grand_product_poly.evals());
       }
     }
+    prover->BatchCommitMultiAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const Prover& lookup_prover : lookup_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
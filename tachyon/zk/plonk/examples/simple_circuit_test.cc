@@ -1,8 +1,14 @@
 #include "tachyon/zk/plonk/examples/simple_circuit.h"
 
+#include <string_view>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "tachyon/base/files/file_enumerator.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 #include "tachyon/zk/base/commitments/shplonk_extension.h"
 #include "tachyon/zk/plonk/examples/circuit_test.h"
@@ -684,6 +690,89 @@ TEST_F(SimpleCircuitTest, LoadProvingKey) {
   }
 }
 
+TEST_F(SimpleCircuitTest, LoadProvingKeyWithCache) {
+  size_t n = 16;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F, SimpleFloorPlanner> circuit(constant, a, b);
+
+  ProvingKey<Poly, Evals, Commitment> expected_pkey;
+  ASSERT_TRUE(expected_pkey.Load(prover_.get(), circuit));
+
+  base::ScopedTempDir dir;
+  ASSERT_TRUE(dir.CreateUniqueTempDir());
+  // NOTE: The cache directory doesn't exist yet, so the first load has to
+  // create it.
+  base::FilePath cache_dir = dir.GetPath().Append("pk");
+  auto get_cache_paths = [&cache_dir]() {
+    std::vector<base::FilePath> paths;
+    base::FileEnumerator enumerator(cache_dir, false,
+                                    base::FileEnumerator::FILES);
+    for (base::FilePath path = enumerator.Next(); !path.empty();
+         path = enumerator.Next()) {
+      paths.push_back(path);
+    }
+    return paths;
+  };
+
+  // The first load writes the cache and the second one reads it.
+  for (size_t i = 0; i < 2; ++i) {
+    SCOPED_TRACE(absl::Substitute("i: $0", i));
+    ProvingKey<Poly, Evals, Commitment> pkey;
+    ASSERT_TRUE(pkey.LoadWithCache(prover_.get(), circuit, cache_dir));
+    EXPECT_EQ(get_cache_paths().size(), size_t{1});
+
+    const VerifyingKey<F, Commitment>& vkey = pkey.verifying_key();
+    const VerifyingKey<F, Commitment>& expected_vkey =
+        expected_pkey.verifying_key();
+    EXPECT_EQ(vkey.fixed_commitments(), expected_vkey.fixed_commitments());
+    EXPECT_EQ(vkey.permutation_verifying_key(),
+              expected_vkey.permutation_verifying_key());
+    EXPECT_EQ(vkey.transcript_repr(), expected_vkey.transcript_repr());
+    EXPECT_EQ(pkey.l_first(), expected_pkey.l_first());
+    EXPECT_EQ(pkey.l_last(), expected_pkey.l_last());
+    EXPECT_EQ(pkey.l_active_row(), expected_pkey.l_active_row());
+    EXPECT_EQ(pkey.fixed_columns(), expected_pkey.fixed_columns());
+    EXPECT_EQ(pkey.fixed_polys(), expected_pkey.fixed_polys());
+    EXPECT_EQ(pkey.permutation_proving_key(),
+              expected_pkey.permutation_proving_key());
+  }
+  std::vector<base::FilePath> cache_paths = get_cache_paths();
+  ASSERT_EQ(cache_paths.size(), size_t{1});
+  base::FilePath cache_path = cache_paths[0];
+
+  // A different circuit doesn't hit the cache.
+  SimpleCircuit<F, SimpleFloorPlanner> circuit2(constant + F::One(), a, b);
+  ProvingKey<Poly, Evals, Commitment> pkey2;
+  ASSERT_TRUE(pkey2.LoadWithCache(prover_.get(), circuit2, cache_dir));
+  EXPECT_NE(pkey2.fixed_polys(), expected_pkey.fixed_polys());
+  cache_paths = get_cache_paths();
+  ASSERT_EQ(cache_paths.size(), size_t{2});
+  base::FilePath cache_path2 =
+      cache_paths[0] == cache_path ? cache_paths[1] : cache_paths[0];
+
+  // Once the cache of |circuit| is replaced with the one of |circuit2|, the
+  // key of |circuit| has the polynomials of |circuit2|, which shows that
+  // they are read from the cache instead of being computed.
+  ASSERT_TRUE(base::CopyFile(cache_path2, cache_path));
+  ProvingKey<Poly, Evals, Commitment> pkey;
+  ASSERT_TRUE(pkey.LoadWithCache(prover_.get(), circuit, cache_dir));
+  EXPECT_EQ(pkey.fixed_polys(), pkey2.fixed_polys());
+
+  // A broken cache is ignored and written again.
+  ASSERT_TRUE(base::WriteFile(cache_path, std::string_view("broken")));
+  ProvingKey<Poly, Evals, Commitment> pkey3;
+  ASSERT_TRUE(pkey3.LoadWithCache(prover_.get(), circuit, cache_dir));
+  EXPECT_EQ(pkey3.fixed_polys(), expected_pkey.fixed_polys());
+  ProvingKey<Poly, Evals, Commitment> pkey4;
+  ASSERT_TRUE(pkey4.LoadWithCache(prover_.get(), circuit, cache_dir));
+  EXPECT_EQ(pkey4.fixed_polys(), expected_pkey.fixed_polys());
+}
+
 TEST_F(SimpleCircuitTest, CreateProof) {
   size_t n = 16;
   CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
@@ -972,4 +1061,51 @@ TEST_F(SimpleCircuitTest, Verify) {
   EXPECT_EQ(h_eval, expected_h_eval);
 }
 
+TEST_F(SimpleCircuitTest, BatchVerifyProofs) {
+  size_t n = 16;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  F constant(7);
+  F a(2);
+  F b(3);
+  SimpleCircuit<F, SimpleFloorPlanner> circuit(constant, a, b);
+
+  VerifyingKey<F, Commitment> vkey;
+  ASSERT_TRUE(vkey.Load(prover_.get(), circuit));
+
+  constexpr size_t kNumProofs = 3;
+  std::vector<uint8_t> owned_proof(std::begin(kExpectedProof),
+                                   std::end(kExpectedProof));
+  std::vector<std::vector<uint8_t>> owned_proofs(kNumProofs, owned_proof);
+  Verifier<PCS> verifier =
+      CreateVerifier(CreateBufferWithProof(absl::MakeSpan(owned_proof)));
+
+  F c = constant * a.Square() * b.Square();
+  std::vector<Evals> instance_columns = {Evals({c})};
+  std::vector<std::vector<std::vector<Evals>>> instance_columns_vecs(
+      kNumProofs, {instance_columns, instance_columns});
+
+  auto batch_verify_proofs = [&verifier, &vkey, &owned_proofs,
+                              &instance_columns_vecs]() {
+    std::vector<std::unique_ptr<crypto::TranscriptReader<Commitment>>>
+        readers = base::Map(owned_proofs, [](std::vector<uint8_t>& proof) {
+          std::unique_ptr<crypto::TranscriptReader<Commitment>> reader =
+              std::make_unique<Blake2bReader<Commitment>>(
+                  CreateBufferWithProof(absl::MakeSpan(proof)));
+          return reader;
+        });
+    std::vector<crypto::TranscriptReader<Commitment>*> reader_ptrs =
+        base::Map(readers,
+                  [](std::unique_ptr<crypto::TranscriptReader<Commitment>>&
+                         reader) { return reader.get(); });
+    return verifier.BatchVerifyProofs(vkey, reader_ptrs, instance_columns_vecs);
+  };
+  EXPECT_TRUE(batch_verify_proofs());
+
+  // One of the proofs doesn't match with its instance columns.
+  instance_columns_vecs[1][0] = {Evals({c + F::One()})};
+  EXPECT_FALSE(batch_verify_proofs());
+}
+
 }  // namespace tachyon::zk::plonk::halo2
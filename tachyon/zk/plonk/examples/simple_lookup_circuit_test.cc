@@ -9,6 +9,7 @@
 #include "tachyon/zk/base/commitments/shplonk_extension.h"
 #include "tachyon/zk/plonk/examples/circuit_test.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
+#include "tachyon/zk/plonk/halo2/proof_size.h"
 #include "tachyon/zk/plonk/keys/proving_key.h"
 #include "tachyon/zk/plonk/layout/floor_planner/simple_floor_planner.h"
 
@@ -573,6 +574,9 @@ TEST_F(SimpleLookupCircuitTest, CreateProof) {
   std::vector<uint8_t> expected_proof(std::begin(kExpectedProof),
                                       std::end(kExpectedProof));
   EXPECT_THAT(proof, testing::ContainerEq(expected_proof));
+  EXPECT_LE(proof.size(),
+            ComputeMaxProofSize<PCS>(pkey.verifying_key().constraint_system(),
+                                     circuits.size()));
 }
 
 TEST_F(SimpleLookupCircuitTest, Verify) {
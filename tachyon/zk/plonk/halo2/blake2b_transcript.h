@@ -40,25 +40,26 @@ class Blake2bBase {
   }
 
   bool DoWriteToTranscript(const AffinePoint& point) {
-    DoUpdate(kBlake2bPrefixPoint, 1);
-    if (point.infinity()) {
-      DoUpdate(BaseField::BigIntTy::Zero().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-      DoUpdate(typename BaseField::BigIntTy(5).ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-    } else {
-      DoUpdate(point.x().ToBigInt().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-      DoUpdate(point.y().ToBigInt().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-    }
+    uint8_t bytes[kPointEntrySize];
+    SerializePoint(point, bytes);
+    DoUpdate(bytes, kPointEntrySize);
     return true;
   }
 
   bool DoWriteToTranscript(const ScalarField& scalar) {
-    DoUpdate(kBlake2bPrefixScalar, 1);
-    DoUpdate(scalar.ToBigInt().ToBytesLE().data(),
-             ScalarField::BigIntTy::kByteNums);
+    uint8_t bytes[kScalarEntrySize];
+    SerializeScalar(scalar, bytes);
+    DoUpdate(bytes, kScalarEntrySize);
+    return true;
+  }
+
+  bool DoWriteToTranscript(absl::Span<const AffinePoint> points) {
+    WriteInBlocks<kPointEntrySize>(points, &SerializePoint);
+    return true;
+  }
+
+  bool DoWriteToTranscript(absl::Span<const ScalarField> scalars) {
+    WriteInBlocks<kScalarEntrySize>(scalars, &SerializeScalar);
     return true;
   }
 
@@ -99,6 +100,52 @@ class Blake2bBase {
   }
 
   BLAKE2B_CTX state_;
+
+ private:
+  constexpr static size_t kBaseFieldByteNums = BaseField::BigIntTy::kByteNums;
+  constexpr static size_t kScalarFieldByteNums =
+      ScalarField::BigIntTy::kByteNums;
+  // A prefix followed by the coordinates.
+  constexpr static size_t kPointEntrySize = 1 + 2 * kBaseFieldByteNums;
+  // A prefix followed by the scalar.
+  constexpr static size_t kScalarEntrySize = 1 + kScalarFieldByteNums;
+  // NOTE: The serialized elements are hashed by 8 blocks of BLAKE2b at once.
+  constexpr static size_t kBlockSize = 8 * BLAKE2B_CBLOCK;
+
+  static void SerializePoint(const AffinePoint& point, uint8_t* bytes) {
+    bytes[0] = kBlake2bPrefixPoint[0];
+    if (point.infinity()) {
+      BaseField::BigIntTy::Zero().ToBytesLE(&bytes[1]);
+      typename BaseField::BigIntTy(5).ToBytesLE(&bytes[1 + kBaseFieldByteNums]);
+    } else {
+      point.x().ToBigInt().ToBytesLE(&bytes[1]);
+      point.y().ToBigInt().ToBytesLE(&bytes[1 + kBaseFieldByteNums]);
+    }
+  }
+
+  static void SerializeScalar(const ScalarField& scalar, uint8_t* bytes) {
+    bytes[0] = kBlake2bPrefixScalar[0];
+    scalar.ToBigInt().ToBytesLE(&bytes[1]);
+  }
+
+  // Serializes |values| into a block on the stack and updates the state once
+  // for every block instead of a few times for every value.
+  template <size_t EntrySize, typename T>
+  void WriteInBlocks(absl::Span<const T> values,
+                     void (*serialize)(const T&, uint8_t*)) {
+    static_assert(EntrySize <= kBlockSize);
+    uint8_t block[kBlockSize];
+    size_t size = 0;
+    for (const T& value : values) {
+      if (size + EntrySize > kBlockSize) {
+        DoUpdate(block, size);
+        size = 0;
+      }
+      serialize(value, &block[size]);
+      size += EntrySize;
+    }
+    if (size > 0) DoUpdate(block, size);
+  }
 };
 
 }  // namespace internal
@@ -127,6 +174,14 @@ class Blake2bReader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoWriteToTranscript(scalars);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -170,6 +225,14 @@ class Blake2bWriter : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoWriteToTranscript(scalars);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
     return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
@@ -11,6 +11,7 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::plonk::halo2 {
@@ -54,6 +55,32 @@ TEST_F(Blake2bTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Blake2bTranscriptTest, WriteManyToProof) {
+  // NOTE: There are enough elements to fill more than a block.
+  std::vector<G1AffinePoint> points =
+      base::CreateVector(40, []() { return G1AffinePoint::Random(); });
+  points.push_back(G1AffinePoint::Zero());
+  std::vector<Fr> scalars =
+      base::CreateVector(40, []() { return Fr::Random(); });
+
+  base::Uint8VectorBuffer write_buf;
+  Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
+  ASSERT_TRUE(writer.WriteToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer.WriteToProof(absl::MakeConstSpan(scalars)));
+
+  base::Uint8VectorBuffer write_buf2;
+  Blake2bWriter<G1AffinePoint> writer2(std::move(write_buf2));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer2.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(writer2.WriteToProof(scalar));
+  }
+
+  EXPECT_EQ(writer.buffer().owned_buffer(), writer2.buffer().owned_buffer());
+  EXPECT_EQ(writer.SqueezeChallenge(), writer2.SqueezeChallenge());
+}
+
 TEST_F(Blake2bTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
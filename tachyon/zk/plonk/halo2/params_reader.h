@@ -0,0 +1,354 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_PARAMS_READER_H_
+#define TACHYON_ZK_PLONK_HALO2_PARAMS_READER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/base/random.h"
+#include "tachyon/crypto/commitments/kzg/kzg.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+namespace internal {
+
+template <typename F>
+constexpr size_t GetFieldByteSize() {
+  if constexpr (F::ExtensionDegree() == 1) {
+    return F::kLimbNums * sizeof(uint64_t);
+  } else {
+    return 2 * GetFieldByteSize<typename F::BaseField>();
+  }
+}
+
+// Reads |F| from |bytes| in little endian, where the coefficients of a
+// quadratic extension field are laid out in order. Returns false if it isn't
+// in canonical form.
+template <typename F>
+bool ReadFieldLE(const uint8_t* bytes, F* ret) {
+  if constexpr (F::ExtensionDegree() == 1) {
+    using BigInt = typename F::BigIntTy;
+    BigInt value = BigInt::FromBytesLE(
+        absl::Span<const uint8_t>(bytes, GetFieldByteSize<F>()));
+    if (value >= F::Config::kModulus) return false;
+    *ret = F::FromBigInt(value);
+    return true;
+  } else {
+    using BaseField = typename F::BaseField;
+    BaseField c0;
+    BaseField c1;
+    if (!ReadFieldLE(bytes, &c0) ||
+        !ReadFieldLE(bytes + GetFieldByteSize<BaseField>(), &c1)) {
+      return false;
+    }
+    *ret = F(std::move(c0), std::move(c1));
+    return true;
+  }
+}
+
+// Returns the parity of the first byte of |f| in little endian.
+template <typename F>
+bool IsOdd(const F& f) {
+  if constexpr (F::ExtensionDegree() == 1) {
+    return f.ToBigInt().IsOdd();
+  } else {
+    return IsOdd(f.c0());
+  }
+}
+
+}  // namespace internal
+
+// Reads the params of KZG written by |ParamsKZG::write()| of halo2, which
+// are k as a 4-byte little-endian integer, 2ᵏ monomial bases and 2ᵏ
+// Lagrange bases of G1, and g₂ and τg₂ of G2. Every point is compressed into
+// its x-coordinate in little endian, whose most significant bit is the
+// parity of y. A zero x-coordinate without the bit is the identity.
+//
+// Every compressed point costs a square root, so the points are decompressed
+// by chunks in parallel straight from the mapped file, with the square roots
+// of a chunk batched by |SquareRoots()|. The G1 points are then checked to be
+// in the prime order subgroup at once by |CheckSubgroup()|, and τg₂ is checked
+// on its own by |IsInSubgroup()|. A curve whose cofactor is 1 may skip the
+// check, since decompression already puts the points on the curve.
+template <typename Curve>
+class ParamsReader {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using ScalarField = typename G1Point::ScalarField;
+
+  // The number of points decompressed by a thread at a time.
+  constexpr static size_t kChunkSize = size_t{1} << 12;
+
+  constexpr static size_t kG1ByteSize =
+      internal::GetFieldByteSize<typename G1Point::BaseField>();
+  constexpr static size_t kG2ByteSize =
+      internal::GetFieldByteSize<typename G2Point::BaseField>();
+
+  bool check_g1_subgroup() const { return check_g1_subgroup_; }
+  void set_check_g1_subgroup(bool check_g1_subgroup) {
+    check_g1_subgroup_ = check_g1_subgroup;
+  }
+
+  bool check_g2_subgroup() const { return check_g2_subgroup_; }
+  void set_check_g2_subgroup(bool check_g2_subgroup) {
+    check_g2_subgroup_ = check_g2_subgroup;
+  }
+
+  // Maps the file at |path| and reads the params downsized to 2ᵏ points into
+  // |kzg| and |s_g2|. See |Read()|.
+  template <size_t MaxDegree, typename Commitment>
+  [[nodiscard]] bool ReadFromFile(
+      const base::FilePath& path, uint32_t k,
+      crypto::KZG<G1Point, MaxDegree, Commitment>* kzg, G2Point* s_g2) const {
+    base::MemoryMappedFile file;
+    if (!file.Initialize(path)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+    return Read(file.bytes(), k, kzg, s_g2);
+  }
+
+  // Reads the params downsized to 2ᵏ points into |kzg| and |s_g2|. If |k| is
+  // less than the one of |bytes|, the Lagrange bases aren't read but derived
+  // from the monomial bases, since they differ by the domain. Returns false
+  // if |bytes| is malformed, |k| is larger than the one of |bytes|, g₂ isn't
+  // the generator or a point isn't in the prime order subgroup.
+  template <size_t MaxDegree, typename Commitment>
+  [[nodiscard]] bool Read(absl::Span<const uint8_t> bytes, uint32_t k,
+                          crypto::KZG<G1Point, MaxDegree, Commitment>* kzg,
+                          G2Point* s_g2) const {
+    if (bytes.size() < sizeof(uint32_t)) {
+      LOG(ERROR) << "Params are too short";
+      return false;
+    }
+    uint32_t params_k = uint32_t{bytes[0]} | uint32_t{bytes[1]} << 8 |
+                        uint32_t{bytes[2]} << 16 | uint32_t{bytes[3]} << 24;
+    if (k > params_k || params_k >= 64) {
+      LOG(ERROR) << "Params of k = " << params_k << " can't be read as k = "
+                 << k;
+      return false;
+    }
+    size_t params_n = size_t{1} << params_k;
+    size_t n = size_t{1} << k;
+    if (n > MaxDegree + 1) {
+      LOG(ERROR) << "k is too large: " << k;
+      return false;
+    }
+    if (bytes.size() !=
+        sizeof(uint32_t) + 2 * params_n * kG1ByteSize + 2 * kG2ByteSize) {
+      LOG(ERROR) << "Params have an unexpected size: " << bytes.size();
+      return false;
+    }
+
+    const uint8_t* g = bytes.data() + sizeof(uint32_t);
+    const uint8_t* g_lagrange = g + params_n * kG1ByteSize;
+    const uint8_t* g2 = g_lagrange + params_n * kG1ByteSize;
+
+    std::vector<G1Point> g1_powers_of_tau(n);
+    if (!DecompressPoints(g, absl::MakeSpan(g1_powers_of_tau))) {
+      LOG(ERROR) << "Failed to read monomial bases";
+      return false;
+    }
+    std::vector<G1Point> g1_powers_of_tau_lagrange;
+    if (n == params_n) {
+      g1_powers_of_tau_lagrange.resize(n);
+      if (!DecompressPoints(g_lagrange,
+                            absl::MakeSpan(g1_powers_of_tau_lagrange))) {
+        LOG(ERROR) << "Failed to read Lagrange bases";
+        return false;
+      }
+    }
+    G2Point g2_points[2];
+    if (!DecompressPoints(g2, absl::MakeSpan(g2_points))) {
+      LOG(ERROR) << "Failed to read G2 points";
+      return false;
+    }
+    if (g2_points[0] != G2Point::Generator()) {
+      LOG(ERROR) << "g₂ isn't the generator";
+      return false;
+    }
+
+    if (check_g1_subgroup_) {
+      if (!CheckSubgroup(absl::MakeConstSpan(g1_powers_of_tau)) ||
+          !CheckSubgroup(absl::MakeConstSpan(g1_powers_of_tau_lagrange))) {
+        LOG(ERROR) << "G1 points aren't in the prime order subgroup";
+        return false;
+      }
+    }
+    // NOTE: g₂ is already checked to be the generator, so only τg₂ is left.
+    // It is checked on its own, since |CheckSubgroup()| can't be trusted for
+    // G2, whose cofactor has small prime factors.
+    if (check_g2_subgroup_) {
+      if (!IsInSubgroup(g2_points[1])) {
+        LOG(ERROR) << "τg₂ isn't in the prime order subgroup";
+        return false;
+      }
+    }
+
+    if (n == params_n) {
+      *kzg = crypto::KZG<G1Point, MaxDegree, Commitment>(
+          std::move(g1_powers_of_tau), std::move(g1_powers_of_tau_lagrange));
+    } else {
+      *kzg = crypto::KZG<G1Point, MaxDegree, Commitment>(
+          std::move(g1_powers_of_tau), std::vector<G1Point>(n));
+      if (!kzg->DeriveLagrangeFromMonomial()) return false;
+    }
+    *s_g2 = std::move(g2_points[1]);
+    return true;
+  }
+
+  // Decompresses a point from |bytes|. Returns false if the x-coordinate
+  // isn't in canonical form or isn't on the curve.
+  template <typename Point>
+  [[nodiscard]] static bool DecompressPoint(const uint8_t* bytes,
+                                            Point* point) {
+    using BaseField = typename Point::BaseField;
+
+    BaseField x;
+    bool is_odd;
+    if (!ReadCompressedX(bytes, &x, &is_odd)) return false;
+    if (x.IsZero() && !is_odd) {
+      *point = Point::Zero();
+      return true;
+    }
+    BaseField y;
+    if (!ComputeYSquare<Point>(x).SquareRoot(&y)) return false;
+    if (internal::IsOdd(y) != is_odd) y.NegInPlace();
+    *point = Point(std::move(x), std::move(y));
+    return true;
+  }
+
+  // Returns true if |point| is in the prime order subgroup of order r, that
+  // is, [r]P = 0.
+  template <typename Point>
+  [[nodiscard]] static bool IsInSubgroup(const Point& point) {
+    return point.ScalarMul(ScalarField::Config::kModulus).IsZero();
+  }
+
+  // Returns true if |points| are all in the prime order subgroup of order r.
+  // Instead of checking [r]Pᵢ = 0 one by one, this checks [r](Σᵢ sᵢPᵢ) = 0
+  // with random 128-bit scalars sᵢ, which costs an MSM and a scalar
+  // multiplication. A point out of the subgroup passes with probability 1/q,
+  // where q is the smallest prime factor of the cofactor. So this is only
+  // sound for a group whose cofactor is 1 or has no small prime factor, such
+  // as G1 of BN254. For G2 of BN254, q is 10069, so a crafted point passes
+  // with probability about 2⁻¹³, and |IsInSubgroup()| must be used there
+  // instead.
+  template <typename Point>
+  [[nodiscard]] static bool CheckSubgroup(absl::Span<const Point> points) {
+    using MSM = math::VariableBaseMSM<Point>;
+    using BigInt = typename ScalarField::BigIntTy;
+
+    if (points.empty()) return true;
+    std::vector<ScalarField> scalars = base::CreateVector(points.size(), []() {
+      BigInt value;
+      value[0] = base::Uniform(base::Range<uint64_t>::All());
+      value[1] = base::Uniform(base::Range<uint64_t>::All());
+      return ScalarField::FromBigInt(value);
+    });
+    typename MSM::Bucket sum;
+    MSM msm;
+    if (!msm.Run(points, scalars, &sum)) return false;
+    return sum.ScalarMul(ScalarField::Config::kModulus).IsZero();
+  }
+
+ private:
+  // Reads the x-coordinate of a compressed point and the parity of its
+  // y-coordinate from |bytes|. Returns false if x isn't in canonical form.
+  template <typename BaseField>
+  static bool ReadCompressedX(const uint8_t* bytes, BaseField* x,
+                              bool* is_odd) {
+    constexpr size_t kByteSize = internal::GetFieldByteSize<BaseField>();
+
+    uint8_t x_bytes[kByteSize];
+    memcpy(x_bytes, bytes, kByteSize);
+    *is_odd = x_bytes[kByteSize - 1] >> 7;
+    x_bytes[kByteSize - 1] &= 0b01111111;
+    return internal::ReadFieldLE(x_bytes, x);
+  }
+
+  // Returns x³ + ax + b.
+  template <typename Point>
+  static typename Point::BaseField ComputeYSquare(
+      const typename Point::BaseField& x) {
+    using CurveConfig = typename Point::Curve::Config;
+
+    typename Point::BaseField right = x.Square() * x + CurveConfig::kB;
+    if constexpr (!CurveConfig::kAIsZero) {
+      right += CurveConfig::kA * x;
+    }
+    return right;
+  }
+
+  // Decompresses |points| from |bytes| by chunks in parallel. The square
+  // roots of a chunk are computed by a single |SquareRoots()|, which sets up
+  // the exponent and the tables of the base field once for the chunk.
+  template <typename Point>
+  static bool DecompressPoints(const uint8_t* bytes,
+                               absl::Span<Point> points) {
+    using BaseField = typename Point::BaseField;
+    constexpr size_t kByteSize = internal::GetFieldByteSize<BaseField>();
+
+    std::atomic<bool> failed = false;
+    base::ParallelizeByChunkSize(
+        points, kChunkSize,
+        [bytes, &failed](absl::Span<Point> chunk, size_t chunk_index,
+                         size_t chunk_size) {
+          const uint8_t* chunk_bytes =
+              bytes + chunk_index * chunk_size * kByteSize;
+          std::vector<BaseField> xs(chunk.size());
+          std::vector<BaseField> y_squares(chunk.size());
+          // NOTE: std::vector<bool> isn't used, since it packs the bits.
+          std::vector<uint8_t> is_odds(chunk.size());
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            if (failed.load(std::memory_order_relaxed)) return;
+            bool is_odd;
+            if (!ReadCompressedX(chunk_bytes + i * kByteSize, &xs[i],
+                                 &is_odd)) {
+              failed.store(true, std::memory_order_relaxed);
+              return;
+            }
+            is_odds[i] = is_odd;
+            // The identity takes the square root of zero, which is zero.
+            if (!xs[i].IsZero() || is_odd) {
+              y_squares[i] = ComputeYSquare<Point>(xs[i]);
+            }
+          }
+          std::vector<BaseField> ys(chunk.size());
+          if (!BaseField::SquareRoots(y_squares, &ys)) {
+            failed.store(true, std::memory_order_relaxed);
+            return;
+          }
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            bool is_odd = is_odds[i];
+            if (xs[i].IsZero() && !is_odd) {
+              chunk[i] = Point::Zero();
+              continue;
+            }
+            if (internal::IsOdd(ys[i]) != is_odd) ys[i].NegInPlace();
+            chunk[i] = Point(std::move(xs[i]), std::move(ys[i]));
+          }
+        });
+    return !failed.load(std::memory_order_relaxed);
+  }
+
+  bool check_g1_subgroup_ = true;
+  bool check_g2_subgroup_ = true;
+};
+
+}  // namespace tachyon::zk::plonk::halo2
+
+#endif  // TACHYON_ZK_PLONK_HALO2_PARAMS_READER_H_
@@ -0,0 +1,168 @@
+#include "tachyon/zk/plonk/halo2/params_reader.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+namespace {
+
+using namespace math::bn254;
+
+using Reader = ParamsReader<BN254Curve>;
+using KZG = crypto::KZG<G1AffinePoint, 15, G1AffinePoint>;
+
+class ParamsReaderTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { BN254Curve::Init(); }
+};
+
+template <typename F>
+void AppendField(const F& f, std::vector<uint8_t>& bytes) {
+  if constexpr (F::ExtensionDegree() == 1) {
+    auto f_bytes = f.ToBigInt().ToBytesLE();
+    bytes.insert(bytes.end(), f_bytes.begin(), f_bytes.end());
+  } else {
+    AppendField(f.c0(), bytes);
+    AppendField(f.c1(), bytes);
+  }
+}
+
+// Compresses |point| as |ParamsKZG::write()| of halo2 does.
+template <typename Point>
+void AppendPoint(const Point& point, std::vector<uint8_t>& bytes) {
+  if (point.infinity()) {
+    bytes.resize(bytes.size() + internal::GetFieldByteSize<
+                                    typename Point::BaseField>());
+    return;
+  }
+  AppendField(point.x(), bytes);
+  bytes.back() |= uint8_t{internal::IsOdd(point.y())} << 7;
+}
+
+std::vector<uint8_t> WriteParams(uint32_t k, const Fr& tau) {
+  KZG kzg;
+  CHECK(kzg.UnsafeSetup(size_t{1} << k, tau));
+  std::vector<uint8_t> bytes = {static_cast<uint8_t>(k), 0, 0, 0};
+  for (const G1AffinePoint& point : kzg.g1_powers_of_tau()) {
+    AppendPoint(point, bytes);
+  }
+  for (const G1AffinePoint& point : kzg.g1_powers_of_tau_lagrange()) {
+    AppendPoint(point, bytes);
+  }
+  AppendPoint(G2AffinePoint::Generator(), bytes);
+  AppendPoint((G2AffinePoint::Generator() * tau).ToAffine(), bytes);
+  return bytes;
+}
+
+}  // namespace
+
+TEST_F(ParamsReaderTest, Read) {
+  Fr tau = Fr::Random();
+  std::vector<uint8_t> bytes = WriteParams(3, tau);
+
+  KZG expected;
+  ASSERT_TRUE(expected.UnsafeSetup(8, tau));
+  KZG kzg;
+  G2AffinePoint s_g2;
+  ASSERT_TRUE(Reader().Read(bytes, 3, &kzg, &s_g2));
+  EXPECT_EQ(kzg.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(kzg.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+  EXPECT_EQ(s_g2, (G2AffinePoint::Generator() * tau).ToAffine());
+
+  // The Lagrange bases of a smaller k are derived from the monomial bases.
+  ASSERT_TRUE(expected.UnsafeSetup(4, tau));
+  ASSERT_TRUE(Reader().Read(bytes, 2, &kzg, &s_g2));
+  EXPECT_EQ(kzg.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_EQ(kzg.g1_powers_of_tau_lagrange(),
+            expected.g1_powers_of_tau_lagrange());
+
+  EXPECT_FALSE(Reader().Read(bytes, 4, &kzg, &s_g2));
+  bytes.pop_back();
+  EXPECT_FALSE(Reader().Read(bytes, 3, &kzg, &s_g2));
+}
+
+TEST_F(ParamsReaderTest, ReadFromFile) {
+  Fr tau = Fr::Random();
+  std::vector<uint8_t> bytes = WriteParams(3, tau);
+  base::ScopedTempDir dir;
+  ASSERT_TRUE(dir.CreateUniqueTempDir());
+  base::FilePath path = dir.GetPath().Append("params");
+  ASSERT_TRUE(base::WriteFile(path, bytes));
+
+  KZG expected;
+  ASSERT_TRUE(expected.UnsafeSetup(8, tau));
+  KZG kzg;
+  G2AffinePoint s_g2;
+  ASSERT_TRUE(Reader().ReadFromFile(path, 3, &kzg, &s_g2));
+  EXPECT_EQ(kzg.g1_powers_of_tau(), expected.g1_powers_of_tau());
+  EXPECT_FALSE(
+      Reader().ReadFromFile(dir.GetPath().Append("missing"), 3, &kzg, &s_g2));
+}
+
+TEST_F(ParamsReaderTest, DecompressPoint) {
+  for (const G1AffinePoint& expected :
+       {G1AffinePoint::Zero(), G1AffinePoint::Random(),
+        -G1AffinePoint::Generator()}) {
+    std::vector<uint8_t> bytes;
+    AppendPoint(expected, bytes);
+    G1AffinePoint point;
+    ASSERT_TRUE(Reader::DecompressPoint(bytes.data(), &point));
+    EXPECT_EQ(point, expected);
+  }
+  for (const G2AffinePoint& expected :
+       {G2AffinePoint::Random(), -G2AffinePoint::Generator()}) {
+    std::vector<uint8_t> bytes;
+    AppendPoint(expected, bytes);
+    G2AffinePoint point;
+    ASSERT_TRUE(Reader::DecompressPoint(bytes.data(), &point));
+    EXPECT_EQ(point, expected);
+  }
+
+  // x is not in canonical form.
+  auto bytes = Fq::Config::kModulus.ToBytesLE();
+  G1AffinePoint point;
+  EXPECT_FALSE(Reader::DecompressPoint(bytes.data(), &point));
+}
+
+TEST_F(ParamsReaderTest, CheckSubgroup) {
+  std::vector<G2AffinePoint> points =
+      base::CreateVector(5, []() { return G2AffinePoint::Random(); });
+  EXPECT_TRUE(Reader::CheckSubgroup(absl::MakeConstSpan(points)));
+
+  // A point on the twist is out of the subgroup with overwhelming
+  // probability.
+  G2AffinePoint point;
+  std::vector<uint8_t> bytes;
+  do {
+    bytes.clear();
+    AppendField(Fq2::Random(), bytes);
+    bytes.back() &= 0b01111111;
+  } while (!Reader::DecompressPoint(bytes.data(), &point));
+  points.push_back(point);
+  EXPECT_FALSE(Reader::CheckSubgroup(absl::MakeConstSpan(points)));
+}
+
+TEST_F(ParamsReaderTest, IsInSubgroup) {
+  EXPECT_TRUE(Reader::IsInSubgroup(G2AffinePoint::Random()));
+  EXPECT_TRUE(Reader::IsInSubgroup(G2AffinePoint::Zero()));
+
+  // A point on the twist whose order isn't r.
+  G2AffinePoint point;
+  std::vector<uint8_t> bytes;
+  do {
+    bytes.clear();
+    AppendField(Fq2::Random(), bytes);
+    bytes.back() &= 0b01111111;
+  } while (!Reader::DecompressPoint(bytes.data(), &point));
+  EXPECT_FALSE(Reader::IsInSubgroup(point));
+}
+
+}  // namespace tachyon::zk::plonk::halo2
@@ -23,6 +23,8 @@ template <typename F>
 class ProofSerializer<
     F, std::enable_if_t<std::is_base_of_v<math::PrimeFieldBase<F>, F>>> {
  public:
+  constexpr static size_t kByteSize = F::kLimbNums * sizeof(uint64_t);
+
   [[nodiscard]] static bool ReadFromProof(const base::ReadOnlyBuffer& buffer,
                                           F* scalar) {
     return buffer.Read(scalar);
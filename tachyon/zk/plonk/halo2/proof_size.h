@@ -0,0 +1,81 @@
+#ifndef TACHYON_ZK_PLONK_HALO2_PROOF_SIZE_H_
+#define TACHYON_ZK_PLONK_HALO2_PROOF_SIZE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "tachyon/zk/plonk/constraint_system/constraint_system.h"
+#include "tachyon/zk/plonk/halo2/proof_serializer.h"
+
+namespace tachyon::zk::plonk::halo2 {
+
+// Returns an upper bound of the size of the proof of |num_circuits| circuits
+// with |constraint_system| in bytes. It follows the layout that |ProofReader|
+// reads, and it bounds the commitments of the multi-opening by the number of
+// distinct points, which is what GWC writes and more than what SHPLONK writes.
+// A proof writer can reserve its buffer with it up front, so that it never
+// reallocates the buffer while proving.
+template <typename PCS>
+size_t ComputeMaxProofSize(
+    const ConstraintSystem<typename PCS::Field>& constraint_system,
+    size_t num_circuits) {
+  using F = typename PCS::Field;
+  using C = typename PCS::Commitment;
+
+  size_t num_lookups = constraint_system.lookups().size();
+  size_t num_permutation_products =
+      constraint_system.ComputePermutationProductNums();
+
+  // The advice commitments, the permuted pairs of the lookups, the grand
+  // products of the permutation and the lookups per circuit.
+  size_t num_commitments =
+      num_circuits * (constraint_system.num_advice_columns() +
+                      3 * num_lookups + num_permutation_products);
+  // The random poly and the h pieces of the vanishing argument.
+  num_commitments += 1 + constraint_system.ComputeDegree() - 1;
+
+  // The queried points are x rotated by the rotations of the queries, and x,
+  // x_prev, x_next and x_last of the permutation and lookup arguments.
+  std::vector<int32_t> rotations;
+  for (const AdviceQueryData& query : constraint_system.advice_queries()) {
+    rotations.push_back(query.rotation().value());
+  }
+  for (const InstanceQueryData& query : constraint_system.instance_queries()) {
+    rotations.push_back(query.rotation().value());
+  }
+  for (const FixedQueryData& query : constraint_system.fixed_queries()) {
+    rotations.push_back(query.rotation().value());
+  }
+  std::sort(rotations.begin(), rotations.end());
+  size_t num_points =
+      std::unique(rotations.begin(), rotations.end()) - rotations.begin() + 4;
+  num_commitments += num_points;
+
+  size_t num_evals_per_circuit = constraint_system.advice_queries().size();
+  if constexpr (PCS::kQueryInstance) {
+    num_evals_per_circuit += constraint_system.instance_queries().size();
+  }
+  // Every permutation product is evaluated at x, x_next and x_last, except
+  // that the last one isn't evaluated at x_last.
+  if (num_permutation_products > 0) {
+    num_evals_per_circuit += 3 * num_permutation_products - 1;
+  }
+  // Every lookup is evaluated at the product, the next product, the permuted
+  // input, the previous permuted input and the permuted table.
+  num_evals_per_circuit += 5 * num_lookups;
+  size_t num_evals = num_circuits * num_evals_per_circuit;
+  // The fixed evals, the random eval of the vanishing argument and the evals
+  // of the permutation proving key.
+  num_evals += constraint_system.fixed_queries().size() + 1 +
+               constraint_system.permutation().columns().size();
+
+  return num_commitments * ProofSerializer<C>::kByteSize +
+         num_evals * ProofSerializer<F>::kByteSize;
+}
+
+}  // namespace tachyon::zk::plonk::halo2
+
+#endif  // TACHYON_ZK_PLONK_HALO2_PROOF_SIZE_H_
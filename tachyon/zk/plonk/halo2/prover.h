@@ -8,13 +8,16 @@
 #define TACHYON_ZK_PLONK_HALO2_PROVER_H_
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "tachyon/device/huge_page_arena.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/lookup/halo2/prover.h"
 #include "tachyon/zk/plonk/halo2/argument_data.h"
 #include "tachyon/zk/plonk/halo2/c_prover_impl_base_forward.h"
+#include "tachyon/zk/plonk/halo2/proof_size.h"
 #include "tachyon/zk/plonk/halo2/random_field_generator.h"
 #include "tachyon/zk/plonk/halo2/verifier.h"
 #include "tachyon/zk/plonk/permutation/permutation_prover.h"
@@ -64,6 +67,15 @@ class Prover : public ProverBase<PCS> {
   crypto::XORShiftRNG* rng() { return rng_.get(); }
   RandomFieldGenerator<F>* generator() { return generator_.get(); }
 
+  device::HugePageArena* huge_page_arena() const { return huge_page_arena_; }
+  // If set, the scratch buffers of the MSMs that |CreateProof()| runs,
+  // including the chunks |PippengerAdapter| hands to the workers, are
+  // allocated from |huge_page_arena|, which keeps its pages faulted in from a
+  // proof to the next. It must outlive the proofs.
+  void set_huge_page_arena(device::HugePageArena* huge_page_arena) {
+    huge_page_arena_ = huge_page_arena;
+  }
+
   Verifier<PCS> ToVerifier(
       std::unique_ptr<crypto::TranscriptReader<Commitment>> reader) {
     Verifier<PCS> ret(std::move(this->pcs_), std::move(reader));
@@ -119,6 +131,9 @@ class Prover : public ProverBase<PCS> {
 
   void CreateProof(ProvingKey<Poly, Evals, Commitment>& proving_key,
                    ArgumentData<Poly, Evals>* argument_data) {
+    std::optional<device::ScopedHugePageArena> scoped_arena;
+    if (huge_page_arena_) scoped_arena.emplace(huge_page_arena_);
+
     // NOTE(chokobole): This is an entry point fom Halo2 rust. So this is the
     // earliest time to log constraint system.
     VLOG(1) << "PCS name: " << this->pcs_.Name() << ", k: " << this->pcs_.K()
@@ -141,6 +156,12 @@ class Prover : public ProverBase<PCS> {
     const Domain* domain = this->domain();
 
     crypto::TranscriptWriter<Commitment>* writer = this->GetWriter();
+    // NOTE: The buffer is reserved for the whole proof up front, so that it
+    // isn't reallocated while the proof is written to it.
+    base::Uint8VectorBuffer& buffer = writer->buffer();
+    buffer.Reserve(buffer.buffer_len() +
+                   ComputeMaxProofSize<PCS>(cs, num_circuits));
+
     F theta = writer->SqueezeChallenge();
     VLOG(2) << "Halo2(theta): " << theta.ToHexString(true);
 
@@ -325,6 +346,8 @@ class Prover : public ProverBase<PCS> {
 
   std::unique_ptr<crypto::XORShiftRNG> rng_;
   std::unique_ptr<RandomFieldGenerator<F>> generator_;
+  // not owned
+  device::HugePageArena* huge_page_arena_ = nullptr;
 };
 
 }  // namespace tachyon::zk::plonk::halo2
@@ -7,8 +7,12 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_SHA256_TRANSCRIPT_H_
 #define TACHYON_ZK_PLONK_HALO2_SHA256_TRANSCRIPT_H_
 
+#include <stdint.h>
+#include <string.h>
+
 #include <utility>
 
+#include "absl/types/span.h"
 #include "openssl/sha.h"
 
 #include "tachyon/base/types/always_false.h"
@@ -45,20 +49,26 @@ class Sha256Base {
   }
 
   bool DoWriteToTranscript(const AffinePoint& point) {
-    DoUpdate(kShaPrefixZeros, SHA256_DIGEST_LENGTH - 1);
-    DoUpdate(kShaPrefixPoint, 1);
-    DoUpdate(point.x().ToBigInt().ToBytesBE().data(),
-             BaseField::BigIntTy::kByteNums);
-    DoUpdate(point.y().ToBigInt().ToBytesBE().data(),
-             BaseField::BigIntTy::kByteNums);
+    uint8_t bytes[kPointEntrySize];
+    SerializePoint(point, bytes);
+    DoUpdate(bytes, kPointEntrySize);
     return true;
   }
 
   bool DoWriteToTranscript(const ScalarField& scalar) {
-    DoUpdate(kShaPrefixZeros, SHA256_DIGEST_LENGTH - 1);
-    DoUpdate(kShaPrefixScalar, 1);
-    DoUpdate(scalar.ToBigInt().ToBytesBE().data(),
-             ScalarField::BigIntTy::kByteNums);
+    uint8_t bytes[kScalarEntrySize];
+    SerializeScalar(scalar, bytes);
+    DoUpdate(bytes, kScalarEntrySize);
+    return true;
+  }
+
+  bool DoWriteToTranscript(absl::Span<const AffinePoint> points) {
+    WriteInBlocks<kPointEntrySize>(points, &SerializePoint);
+    return true;
+  }
+
+  bool DoWriteToTranscript(absl::Span<const ScalarField> scalars) {
+    WriteInBlocks<kScalarEntrySize>(scalars, &SerializeScalar);
     return true;
   }
 
@@ -74,6 +84,51 @@ class Sha256Base {
   }
 
   SHA256_CTX state_;
+
+ private:
+  constexpr static size_t kBaseFieldByteNums = BaseField::BigIntTy::kByteNums;
+  constexpr static size_t kScalarFieldByteNums =
+      ScalarField::BigIntTy::kByteNums;
+  constexpr static size_t kPrefixSize = SHA256_DIGEST_LENGTH;
+  // Zeros and a prefix followed by the coordinates.
+  constexpr static size_t kPointEntrySize =
+      kPrefixSize + 2 * kBaseFieldByteNums;
+  // Zeros and a prefix followed by the scalar.
+  constexpr static size_t kScalarEntrySize = kPrefixSize + kScalarFieldByteNums;
+  // NOTE: The serialized elements are hashed by 16 blocks of SHA256 at once.
+  constexpr static size_t kBlockSize = 16 * SHA256_CBLOCK;
+
+  static void SerializePoint(const AffinePoint& point, uint8_t* bytes) {
+    memcpy(bytes, kShaPrefixZeros, kPrefixSize - 1);
+    bytes[kPrefixSize - 1] = kShaPrefixPoint[0];
+    point.x().ToBigInt().ToBytesBE(&bytes[kPrefixSize]);
+    point.y().ToBigInt().ToBytesBE(&bytes[kPrefixSize + kBaseFieldByteNums]);
+  }
+
+  static void SerializeScalar(const ScalarField& scalar, uint8_t* bytes) {
+    memcpy(bytes, kShaPrefixZeros, kPrefixSize - 1);
+    bytes[kPrefixSize - 1] = kShaPrefixScalar[0];
+    scalar.ToBigInt().ToBytesBE(&bytes[kPrefixSize]);
+  }
+
+  // Serializes |values| into a block on the stack and updates the state once
+  // for every block instead of a few times for every value.
+  template <size_t EntrySize, typename T>
+  void WriteInBlocks(absl::Span<const T> values,
+                     void (*serialize)(const T&, uint8_t*)) {
+    static_assert(EntrySize <= kBlockSize);
+    uint8_t block[kBlockSize];
+    size_t size = 0;
+    for (const T& value : values) {
+      if (size + EntrySize > kBlockSize) {
+        DoUpdate(block, size);
+        size = 0;
+      }
+      serialize(value, &block[size]);
+      size += EntrySize;
+    }
+    if (size > 0) DoUpdate(block, size);
+  }
 };
 
 }  // namespace internal
@@ -107,6 +162,14 @@ class Sha256Reader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoWriteToTranscript(scalars);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -148,6 +211,14 @@ class Sha256Writer : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoWriteToTranscript(scalars);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
     return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
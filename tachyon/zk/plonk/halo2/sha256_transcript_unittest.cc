@@ -11,6 +11,7 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::plonk::halo2 {
@@ -54,6 +55,36 @@ TEST_F(Sha256TranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Sha256TranscriptTest, WriteManyToProof) {
+  // NOTE: There are enough elements to fill more than a block.
+  std::vector<G1AffinePoint> points =
+      base::CreateVector(40, []() { return G1AffinePoint::Random(); });
+  points.push_back(G1AffinePoint::Zero());
+  std::vector<Fr> scalars =
+      base::CreateVector(40, []() { return Fr::Random(); });
+
+  base::Uint8VectorBuffer write_buf;
+  Sha256Writer<G1AffinePoint> writer(std::move(write_buf));
+  ASSERT_TRUE(writer.WriteToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer.WriteToProof(absl::MakeConstSpan(scalars)));
+
+  base::Uint8VectorBuffer write_buf2;
+  Sha256Writer<G1AffinePoint> writer2(std::move(write_buf2));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(writer2.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(writer2.WriteToProof(scalar));
+  }
+
+  EXPECT_EQ(writer.buffer().owned_buffer(), writer2.buffer().owned_buffer());
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  writer.Finalize(digest);
+  uint8_t digest2[SHA256_DIGEST_LENGTH];
+  writer2.Finalize(digest2);
+  EXPECT_EQ(absl::MakeConstSpan(digest), absl::MakeConstSpan(digest2));
+}
+
 TEST_F(Sha256TranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   Sha256Writer<G1AffinePoint> writer(std::move(write_buf));
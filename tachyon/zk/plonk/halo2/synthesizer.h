@@ -50,11 +50,10 @@ class Synthesizer {
         Circuit::Configure(empty_constraint_system);
 
     for (Phase current_phase : constraint_system_->GetPhases()) {
-      size_t write_idx = 0;
+      std::vector<size_t> current_phase_column_indices = base::FindIndices(
+          constraint_system_->advice_column_phases().begin(),
+          constraint_system_->advice_column_phases().end(), current_phase);
       if constexpr (PCS::kSupportsBatchMode) {
-        std::vector<size_t> current_phase_column_indices = base::FindIndices(
-            constraint_system_->advice_column_phases().begin(),
-            constraint_system_->advice_column_phases().end(), current_phase);
         prover->pcs().SetBatchMode(current_phase_column_indices.size() *
                                    num_circuits_);
       }
@@ -77,9 +76,7 @@ class Synthesizer {
           evaluated[prover->pcs().N() - 1] = F::One();
 
           Evals evaluated_evals(std::move(evaluated));
-          if constexpr (PCS::kSupportsBatchMode) {
-            prover->BatchCommitAt(evaluated_evals, write_idx++);
-          } else {
+          if constexpr (!PCS::kSupportsBatchMode) {
             prover->CommitAndWriteToProof(evaluated_evals);
           }
           SetAdviceColumn(i, j, std::move(evaluated_evals),
@@ -87,6 +84,16 @@ class Synthesizer {
         }
       }
       if constexpr (PCS::kSupportsBatchMode) {
+        // NOTE: The columns of the phase over every circuit are committed at
+        // once, so that the bases are read once for all of them.
+        std::vector<const Evals*> columns;
+        columns.reserve(current_phase_column_indices.size() * num_circuits_);
+        for (size_t i = 0; i < num_circuits_; ++i) {
+          for (size_t j : current_phase_column_indices) {
+            columns.push_back(&advice_columns_vec_[i][j]);
+          }
+        }
+        prover->BatchCommitMultiAt(columns, 0);
         prover->RetrieveAndWriteBatchCommitmentsToProof();
       }
       UpdateChallenges(prover, current_phase);
@@ -7,14 +7,18 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_VERIFIER_H_
 #define TACHYON_ZK_PLONK_HALO2_VERIFIER_H_
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/entities/verifier_base.h"
 #include "tachyon/zk/lookup/lookup_verification.h"
@@ -43,6 +47,58 @@ class Verifier : public VerifierBase<PCS> {
     return VerifyProofForTesting(vkey, instance_columns_vec, nullptr, nullptr);
   }
 
+  // Same as |VerifyProof()|, but the final pairing check is deferred to
+  // |accumulator| instead of being run here. This way, the proofs for the
+  // same |vkey| can be checked at once by |PCS::VerifyPairingAccumulator()|.
+  // Note that the result is valid only if it is checked.
+  template <typename Accumulator>
+  [[nodiscard]] bool VerifyProof(
+      const VerifyingKey<F, Commitment>& vkey,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      Accumulator* accumulator) {
+    return VerifyProofImpl(vkey, CreateVerifyingKeyContext(vkey),
+                           this->GetReader(), instance_columns_vec, nullptr,
+                           nullptr, accumulator);
+  }
+
+  // Verifies the proofs read by |readers| against |vkey| at once, where
+  // |instance_columns_vecs[i]| is the instance columns of the proof read by
+  // |readers[i]|. The values derived from |vkey| are computed once, the proofs
+  // are verified in parallel and their final pairing checks are combined into
+  // a single multi pairing by |PCS::VerifyPairingAccumulator()|. Note that the
+  // transcript of this verifier isn't used.
+  [[nodiscard]] bool BatchVerifyProofs(
+      const VerifyingKey<F, Commitment>& vkey,
+      const std::vector<crypto::TranscriptReader<Commitment>*>& readers,
+      const std::vector<std::vector<std::vector<Evals>>>&
+          instance_columns_vecs) {
+    using PairingAccumulator = typename PCS::PairingAccumulator;
+
+    if (readers.size() != instance_columns_vecs.size()) {
+      LOG(ERROR) << "The number of readers and instance columns don't match";
+      return false;
+    }
+
+    VerifyingKeyContext ctx = CreateVerifyingKeyContext(vkey);
+    std::vector<PairingAccumulator> accumulators(readers.size());
+    std::atomic<bool> failed = false;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < readers.size(); ++i) {
+      if (failed.load(std::memory_order_relaxed)) continue;
+      if (!VerifyProofImpl(vkey, ctx, readers[i], instance_columns_vecs[i],
+                           nullptr, nullptr, &accumulators[i])) {
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+    if (failed.load(std::memory_order_relaxed)) return false;
+
+    PairingAccumulator accumulator;
+    accumulator.Reserve(readers.size());
+    for (const PairingAccumulator& proof_accumulator : accumulators) {
+      accumulator.Merge(proof_accumulator);
+    }
+    return this->pcs_.VerifyPairingAccumulator(accumulator);
+  }
+
  private:
   FRIEND_TEST(SimpleCircuitTest, Verify);
   FRIEND_TEST(SimpleV1CircuitTest, Verify);
@@ -51,11 +107,76 @@ class Verifier : public VerifierBase<PCS> {
   template <typename>
   FRIEND_TEST(ShuffleCircuitTest, Verify);
 
+  struct RotationRange {
+    int32_t min = 0;
+    int32_t max = 0;
+  };
+
+  // The values that depend only on the verifying key. These are computed once
+  // and shared by the proofs verified against the same key.
+  struct VerifyingKeyContext {
+    RowIndex blinding_factors = 0;
+    // The range of the rotations of the instance queries.
+    RotationRange instance_rotation_range;
+    // The number of expressions per circuit combined into the expected
+    // evaluation of h(X).
+    size_t num_expressions_per_circuit = 0;
+  };
+
   bool VerifyProofForTesting(
       const VerifyingKey<F, Commitment>& vkey,
       const std::vector<std::vector<Evals>>& instance_columns_vec,
       Proof<F, Commitment>* proof_out, F* expected_h_eval_out) {
-    if (!ValidateInstanceColumnsVec(vkey, instance_columns_vec)) return false;
+    return VerifyProofImpl<void>(vkey, CreateVerifyingKeyContext(vkey),
+                                 this->GetReader(), instance_columns_vec,
+                                 proof_out, expected_h_eval_out, nullptr);
+  }
+
+  static VerifyingKeyContext CreateVerifyingKeyContext(
+      const VerifyingKey<F, Commitment>& vkey) {
+    const ConstraintSystem<F>& constraint_system = vkey.constraint_system();
+    VerifyingKeyContext ctx;
+    ctx.blinding_factors = constraint_system.ComputeBlindingFactors();
+
+    const std::vector<InstanceQueryData>& instance_queries =
+        constraint_system.instance_queries();
+    ctx.instance_rotation_range = std::accumulate(
+        instance_queries.begin(), instance_queries.end(), RotationRange(),
+        [](RotationRange& range, const InstanceQueryData& instance) {
+          int32_t rotation_value = instance.rotation().value();
+          if (rotation_value < range.min) {
+            range.min = rotation_value;
+          } else if (rotation_value > range.max) {
+            range.max = rotation_value;
+          }
+          return range;
+        });
+
+    const std::vector<Gate<F>>& gates = constraint_system.gates();
+    size_t polys_size = std::accumulate(gates.begin(), gates.end(), 0,
+                                        [](size_t acc, const Gate<F>& gate) {
+                                          return acc + gate.polys().size();
+                                        });
+    ctx.num_expressions_per_circuit =
+        polys_size +
+        GetSizeOfPermutationVerificationExpressions(constraint_system) +
+        constraint_system.lookups().size() *
+            GetSizeOfLookupVerificationExpressions();
+    return ctx;
+  }
+
+  // If |Accumulator| is void, the final pairing check is run in place.
+  // Otherwise, it is deferred to |accumulator|. Since every proof is read from
+  // its own |transcript|, this can be called for many proofs in parallel.
+  template <typename Accumulator>
+  bool VerifyProofImpl(
+      const VerifyingKey<F, Commitment>& vkey, const VerifyingKeyContext& ctx,
+      crypto::TranscriptReader<Commitment>* transcript,
+      const std::vector<std::vector<Evals>>& instance_columns_vec,
+      Proof<F, Commitment>* proof_out, F* expected_h_eval_out,
+      Accumulator* accumulator) {
+    if (!ValidateInstanceColumnsVec(vkey, ctx, instance_columns_vec))
+      return false;
 
     std::vector<std::vector<Commitment>> instance_commitments_vec;
     if constexpr (PCS::kQueryInstance) {
@@ -64,7 +185,6 @@ class Verifier : public VerifierBase<PCS> {
       instance_commitments_vec.resize(instance_columns_vec.size());
     }
 
-    crypto::TranscriptReader<Commitment>* transcript = this->GetReader();
     CHECK(transcript->WriteToTranscript(vkey.transcript_repr()));
 
     if constexpr (PCS::kQueryInstance) {
@@ -91,7 +211,7 @@ class Verifier : public VerifierBase<PCS> {
     } else {
       proof_reader.ReadInstanceEvalsIfNoQueryInstance();
       proof.instance_evals_vec =
-          ComputeInstanceEvalsVec(vkey, instance_columns_vec, proof.x);
+          ComputeInstanceEvalsVec(vkey, ctx, instance_columns_vec, proof.x);
     }
     proof_reader.ReadAdviceEvals();
     proof_reader.ReadFixedEvals();
@@ -105,14 +225,15 @@ class Verifier : public VerifierBase<PCS> {
       *proof_out = proof;
     }
 
-    ComputeAuxValues(vkey.constraint_system(), proof);
+    ComputeAuxValues(ctx, proof);
 
-    return DoVerify(instance_commitments_vec, vkey, proof, expected_h_eval_out);
+    return DoVerify(instance_commitments_vec, vkey, ctx, transcript, proof,
+                    expected_h_eval_out, accumulator);
   }
 
-  void ComputeAuxValues(const ConstraintSystem<F>& constraint_system,
+  void ComputeAuxValues(const VerifyingKeyContext& ctx,
                         Proof<F, Commitment>& proof) const {
-    RowIndex blinding_factors = constraint_system.ComputeBlindingFactors();
+    RowIndex blinding_factors = ctx.blinding_factors;
     std::vector<F> l_evals = this->domain_->EvaluatePartialLagrangeCoefficients(
         proof.x, base::Range<int32_t, /*IsStartInclusive=*/true,
                              /*IsEndInclusive=*/true>(
@@ -131,7 +252,7 @@ class Verifier : public VerifierBase<PCS> {
   }
 
   bool ValidateInstanceColumnsVec(
-      const VerifyingKey<F, Commitment>& vkey,
+      const VerifyingKey<F, Commitment>& vkey, const VerifyingKeyContext& ctx,
       const std::vector<std::vector<Evals>>& instance_columns_vec) const {
     size_t num_instance_columns =
         vkey.constraint_system().num_instance_columns();
@@ -146,8 +267,8 @@ class Verifier : public VerifierBase<PCS> {
         };
 
     // NOTE(chokobole): It's safe to downcast because domain is already checked.
-    RowIndex max_rows = static_cast<RowIndex>(this->pcs_.N()) -
-                        (vkey.constraint_system().ComputeBlindingFactors() + 1);
+    RowIndex max_rows =
+        static_cast<RowIndex>(this->pcs_.N()) - (ctx.blinding_factors + 1);
     auto check_rows = [max_rows](const Evals& instance_columns) {
       if (instance_columns.NumElements() > size_t{max_rows}) {
         LOG(ERROR) << "Too many number of elements in instance column";
@@ -166,12 +287,12 @@ class Verifier : public VerifierBase<PCS> {
                        });
   }
 
+  // NOTE: Instance columns mostly have a few rows of public inputs, so the
+  // MSM runs only over their nonzero rows instead of the whole domain.
   std::vector<Commitment> CommitColumns(const std::vector<Evals>& columns) {
     return base::Map(columns, [this](const Evals& column) {
-      std::vector<F> expanded_evals = column.evaluations();
-      expanded_evals.resize(this->pcs_.N());
       Commitment c;
-      CHECK(this->pcs_.CommitLagrange(Evals(std::move(expanded_evals)), &c));
+      CHECK(this->pcs_.CommitLagrangeSparse(column, &c));
       return c;
     });
   }
@@ -243,26 +364,11 @@ class Verifier : public VerifierBase<PCS> {
   }
 
   std::vector<std::vector<F>> ComputeInstanceEvalsVec(
-      const VerifyingKey<F, Commitment>& vkey,
+      const VerifyingKey<F, Commitment>& vkey, const VerifyingKeyContext& ctx,
       const std::vector<std::vector<Evals>>& instance_columns_vec, const F& x) {
-    struct RotationRange {
-      int32_t min = 0;
-      int32_t max = 0;
-    };
-
     const std::vector<InstanceQueryData>& instance_queries =
         vkey.constraint_system().instance_queries();
-    RotationRange range = std::accumulate(
-        instance_queries.begin(), instance_queries.end(), RotationRange(),
-        [](RotationRange& range, const InstanceQueryData& instance) {
-          int32_t rotation_value = instance.rotation().value();
-          if (rotation_value < range.min) {
-            range.min = rotation_value;
-          } else if (rotation_value > range.max) {
-            range.max = rotation_value;
-          }
-          return range;
-        });
+    const RotationRange& range = ctx.instance_rotation_range;
 
     std::vector<RowIndex> max_instances_rows =
         base::Map(instance_columns_vec, &ComputeMaxRow);
@@ -286,51 +392,43 @@ class Verifier : public VerifierBase<PCS> {
                      });
   }
 
+  // The expressions of each circuit are evaluated in parallel into their own
+  // slice of |expressions|, since their sizes are fixed by the constraint
+  // system.
   F ComputeExpectedHEval(size_t num_circuits,
                          const VerifyingKey<F, Commitment>& vkey,
+                         const VerifyingKeyContext& ctx,
                          const Proof<F, Commitment>& proof) {
     const ConstraintSystem<F>& constraint_system = vkey.constraint_system();
-    std::vector<F> expressions;
     const std::vector<Gate<F>>& gates = constraint_system.gates();
     const std::vector<LookupArgument<F>>& lookups = constraint_system.lookups();
-    size_t polys_size = std::accumulate(gates.begin(), gates.end(), 0,
-                                        [](size_t acc, const Gate<F>& gate) {
-                                          return acc + gate.polys().size();
-                                        });
-    size_t expressions_size =
-        num_circuits *
-        (polys_size +
-         GetSizeOfPermutationVerificationExpressions(constraint_system) +
-         lookups.size() * GetSizeOfLookupVerificationExpressions());
-    expressions.reserve(expressions_size);
-    for (size_t i = 0; i < num_circuits; ++i) {
+    std::vector<F> expressions(num_circuits * ctx.num_expressions_per_circuit);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_circuits; ++i) {
+      auto it = expressions.begin() + i * ctx.num_expressions_per_circuit;
       VanishingVerificationData<F> data = proof.ToVanishingVerificationData(i);
       VanishingVerificationEvaluator<F> vanishing_verification_evaluator(data);
       for (const Gate<F>& gate : gates) {
         for (const std::unique_ptr<Expression<F>>& poly : gate.polys()) {
-          expressions.push_back(
-              poly->Evaluate(&vanishing_verification_evaluator));
+          *(it++) = poly->Evaluate(&vanishing_verification_evaluator);
         }
       }
 
       std::vector<F> permutation_expressions =
           CreatePermutationVerificationExpressions(
               proof.ToPermutationVerificationData(i), constraint_system);
-      expressions.insert(
-          expressions.end(),
-          std::make_move_iterator(permutation_expressions.begin()),
-          std::make_move_iterator(permutation_expressions.end()));
+      it = std::move(permutation_expressions.begin(),
+                     permutation_expressions.end(), it);
 
       for (size_t j = 0; j < lookups.size(); ++j) {
         const LookupArgument<F>& lookup = lookups[j];
         std::vector<F> lookup_expressions = CreateLookupVerificationExpressions(
             proof.ToLookupVerificationData(i, j), lookup);
-        expressions.insert(expressions.end(),
-                           std::make_move_iterator(lookup_expressions.begin()),
-                           std::make_move_iterator(lookup_expressions.end()));
+        it = std::move(lookup_expressions.begin(), lookup_expressions.end(),
+                       it);
       }
+      DCHECK(it ==
+             expressions.begin() + (i + 1) * ctx.num_expressions_per_circuit);
     }
-    DCHECK_EQ(expressions.size(), expressions_size);
     F expected_h_eval =
         F::template LinearCombination</*forward=*/true>(expressions, proof.y);
     return expected_h_eval /= (proof.x_n - F::One());
@@ -366,10 +464,13 @@ class Verifier : public VerifierBase<PCS> {
     }
   }
 
+  template <typename Accumulator>
   bool DoVerify(
       const std::vector<std::vector<Commitment>>& instance_commitments_vec,
-      const VerifyingKey<F, Commitment>& vkey,
-      const Proof<F, Commitment>& proof, F* expected_h_eval_out) {
+      const VerifyingKey<F, Commitment>& vkey, const VerifyingKeyContext& ctx,
+      crypto::TranscriptReader<Commitment>* transcript,
+      const Proof<F, Commitment>& proof, F* expected_h_eval_out,
+      Accumulator* accumulator) {
     std::vector<Opening> queries;
     size_t num_circuits = instance_commitments_vec.size();
 
@@ -437,7 +538,7 @@ class Verifier : public VerifierBase<PCS> {
             proof.vanishing_h_poly_commitments, proof.x_n)
             .ToAffine();
 
-    F expected_h_eval = ComputeExpectedHEval(num_circuits, vkey, proof);
+    F expected_h_eval = ComputeExpectedHEval(num_circuits, vkey, ctx, proof);
 
     if (expected_h_eval_out) {
       *expected_h_eval_out = expected_h_eval;
@@ -450,7 +551,11 @@ class Verifier : public VerifierBase<PCS> {
         base::DeepRef<const F>(&proof.x), proof.vanishing_random_eval);
     DCHECK_EQ(queries.size(), queries_size);
     DCHECK_EQ(points.size(), points_size);
-    return this->pcs_.VerifyOpeningProof(queries, this->GetReader());
+    if constexpr (std::is_void_v<Accumulator>) {
+      return this->pcs_.VerifyOpeningProof(queries, transcript);
+    } else {
+      return this->pcs_.VerifyOpeningProof(queries, transcript, accumulator);
+    }
   }
 };
 
@@ -7,11 +7,24 @@
 #ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 #define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 
+#include <stdint.h>
+
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "openssl/blake2.h"
+
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/strings/rust_stringifier.h"
+#include "tachyon/base/strings/string_number_conversions.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/plonk/halo2/pinned_constraint_system.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_argument.h"
@@ -63,9 +76,49 @@ class ProvingKey : public Key {
     return DoLoad(prover, std::move(pre_load_result), nullptr);
   }
 
+  // Same as |Load()|, but the key is cached in |cache_dir|. The file of the
+  // cache is named after a hash of the constraint system, the fixed columns,
+  // the copy constraints and the params of |prover|, which are all the inputs
+  // of the key besides the ones that are cheap to synthesize again. If the
+  // file exists, the commitments and the polynomials are read from it instead
+  // of being computed. Otherwise, the key is generated and written to it,
+  // creating |cache_dir| if it doesn't exist.
+  template <typename PCS, typename Circuit>
+  [[nodiscard]] bool LoadWithCache(ProverBase<PCS>* prover,
+                                   const Circuit& circuit,
+                                   const base::FilePath& cache_dir) {
+    using RationalEvals = typename PCS::RationalEvals;
+    KeyPreLoadResult<Evals, RationalEvals> pre_load_result;
+    if (!this->PreLoad(prover, circuit, &pre_load_result)) return false;
+
+    base::FilePath cache_path =
+        cache_dir.Append(ComputeCacheKey(prover, pre_load_result));
+    if (base::PathExists(cache_path)) {
+      if (ReadCache(prover, cache_path, pre_load_result)) {
+        VLOG(1) << "Read proving key from " << cache_path.value();
+        return true;
+      }
+      LOG(WARNING) << "Failed to read proving key from " << cache_path.value();
+    }
+
+    VerifyingKeyLoadResult<Evals> vk_result;
+    if (!verifying_key_.DoLoad(prover, std::move(pre_load_result), &vk_result))
+      return false;
+    if (!DoLoad(prover, std::move(pre_load_result), &vk_result)) return false;
+    if (!WriteCache(cache_path)) {
+      LOG(WARNING) << "Failed to write proving key to " << cache_path.value();
+    }
+    return true;
+  }
+
  private:
   friend class c::zk::plonk::ProvingKeyImplBase<Poly, Evals, C>;
 
+  // The personalization of the hash that names the cache.
+  constexpr static char kCacheStr[] = "Tachyon-PK-Cache";
+  // Bump this when the layout of the cache changes.
+  constexpr static uint32_t kCacheVersion = 1;
+
   template <typename PCS, typename RationalEvals>
   bool DoLoad(ProverBase<PCS>* prover,
               KeyPreLoadResult<Evals, RationalEvals>&& pre_load_result,
@@ -80,9 +133,7 @@ class ProvingKey : public Key {
 
     const Domain* domain = prover->domain();
     fixed_columns_ = std::move(pre_load_result.fixed_columns);
-    fixed_polys_ = base::Map(fixed_columns_, [domain](const Evals& evals) {
-      return domain->IFFT(evals);
-    });
+    fixed_polys_ = domain->IFFTs(fixed_columns_);
 
     std::vector<Evals> permutations;
     if (vk_load_result) {
@@ -109,12 +160,11 @@ class ProvingKey : public Key {
     // | 5 | 0          |
     // | 6 | 0          |
     // | 7 | 0          |
-    Evals evals = domain->template Zero<Evals>();
+    std::vector<Evals> l_evals =
+        base::CreateVector(3, domain->template Zero<Evals>());
     // NOTE(chokobole): It's safe to access since we created |domain->size()|
     // |evals|.
-    evals.at(0) = F::One();
-    l_first_ = domain->IFFT(evals);
-    evals.at(0) = F::Zero();
+    l_evals[0].at(0) = F::One();
 
     // Compute l_last(X) which evaluates to 1 on the first inactive row (just
     // before the blinding factors) and 0 otherwise over the domain.
@@ -132,9 +182,7 @@ class ProvingKey : public Key {
     RowIndex usable_rows = prover->GetUsableRows();
     // NOTE(chokobole): It's safe to access since we created |domain->size()|
     // |evals|, which is greater than |usable_rows|.
-    evals.at(usable_rows) = F::One();
-    l_last_ = domain->IFFT(evals);
-    evals.at(usable_rows) = F::Zero();
+    l_evals[1].at(usable_rows) = F::One();
 
     // Compute l_active_row(X).
     //
@@ -151,15 +199,138 @@ class ProvingKey : public Key {
     OPENMP_PARALLEL_FOR(size_t i = 0; i < usable_rows; ++i) {
       // NOTE(chokobole): It's safe to access since we created |domain->size()|
       // |evals|, which is greater than |usable_rows|.
-      evals.at(i) = F::One();
+      l_evals[2].at(i) = F::One();
+    }
+
+    std::vector<Poly> l_polys = domain->IFFTs(std::move(l_evals));
+    l_first_ = std::move(l_polys[0]);
+    l_last_ = std::move(l_polys[1]);
+    l_active_row_ = std::move(l_polys[2]);
+
+    vanishing_argument_ =
+        VanishingArgument<F>::Create(verifying_key_.constraint_system());
+    return true;
+  }
+
+  template <typename PCS, typename RationalEvals>
+  static std::string ComputeCacheKey(
+      const ProverBase<PCS>* prover,
+      const KeyPreLoadResult<Evals, RationalEvals>& pre_load_result) {
+    const PCS& pcs = prover->pcs();
+
+    BLAKE2B_CTX state;
+    BLAKE2B512_InitWithPersonal(&state, kCacheStr);
+    uint64_t n = pcs.N();
+    BLAKE2B512_Update(&state, &n, sizeof(uint64_t));
+
+    // NOTE: The commitment of the first Lagrange basis tells the params apart
+    // with a single base instead of hashing all of them.
+    Evals l_first = prover->domain()->template Zero<Evals>();
+    l_first.at(0) = F::One();
+    C l_first_commitment;
+    CHECK(pcs.CommitLagrangeSparse(l_first, &l_first_commitment));
+    base::Uint8VectorBuffer commitment_buffer;
+    CHECK(commitment_buffer.Write(l_first_commitment));
+    BLAKE2B512_Update(&state, commitment_buffer.owned_buffer().data(),
+                      commitment_buffer.owned_buffer().size());
+
+    std::string cs_str = base::ToRustDebugString(
+        halo2::PinnedConstraintSystem<F>(pre_load_result.constraint_system));
+    size_t cs_str_size = cs_str.size();
+    BLAKE2B512_Update(&state, &cs_str_size, sizeof(size_t));
+    BLAKE2B512_Update(&state, cs_str.data(), cs_str.size());
+
+    for (const Evals& fixed_column : pre_load_result.fixed_columns) {
+      const std::vector<F>& evaluations = fixed_column.evaluations();
+      BLAKE2B512_Update(&state, evaluations.data(),
+                        evaluations.size() * sizeof(F));
+    }
+
+    const PermutationAssembly& permutation =
+        pre_load_result.assembly.permutation();
+    std::vector<uint64_t> next_labels(n);
+    for (size_t i = 0; i < permutation.columns().size(); ++i) {
+      OPENMP_PARALLEL_FOR(RowIndex j = 0; j < n; ++j) {
+        const Label& label =
+            permutation.cycle_store().GetNextLabel(Label(i, j));
+        next_labels[j] = uint64_t{label.col} << 32 | label.row;
+      }
+      BLAKE2B512_Update(&state, next_labels.data(),
+                        next_labels.size() * sizeof(uint64_t));
+    }
+
+    uint8_t result[BLAKE2B512_DIGEST_LENGTH] = {0};
+    BLAKE2B512_Final(result, &state);
+    return base::HexEncode(result, sizeof(result), /*use_lower_case=*/true);
+  }
+
+  template <typename PCS, typename RationalEvals>
+  bool ReadCache(ProverBase<PCS>* prover, const base::FilePath& path,
+                 KeyPreLoadResult<Evals, RationalEvals>& pre_load_result) {
+    base::MemoryMappedFile file;
+    if (!file.Initialize(path)) return false;
+    base::ReadOnlyBuffer buffer(file.data(), file.length());
+
+    uint32_t version;
+    std::vector<C> fixed_commitments;
+    std::vector<C> permutation_commitments;
+    Poly l_first;
+    Poly l_last;
+    Poly l_active_row;
+    std::vector<Poly> fixed_polys;
+    PermutationProvingKey<Poly, Evals> permutation_proving_key;
+    if (!buffer.Read(&version) || version != kCacheVersion) return false;
+    if (!buffer.ReadMany(&fixed_commitments, &permutation_commitments,
+                         &l_first, &l_last, &l_active_row, &fixed_polys,
+                         &permutation_proving_key)) {
+      return false;
     }
-    l_active_row_ = domain->IFFT(std::move(evals));
+    if (!buffer.Done()) return false;
 
+    verifying_key_.constraint_system_ =
+        std::move(pre_load_result.constraint_system);
+    verifying_key_.fixed_commitments_ = std::move(fixed_commitments);
+    verifying_key_.permutation_verifying_key_ =
+        PermutationVerifyingKey<C>(std::move(permutation_commitments));
+    verifying_key_.SetTranscriptRepresentative(prover);
+
+    prover->blinder().set_blinding_factors(
+        verifying_key_.constraint_system().ComputeBlindingFactors());
+    l_first_ = std::move(l_first);
+    l_last_ = std::move(l_last);
+    l_active_row_ = std::move(l_active_row);
+    fixed_columns_ = std::move(pre_load_result.fixed_columns);
+    fixed_polys_ = std::move(fixed_polys);
+    permutation_proving_key_ = std::move(permutation_proving_key);
     vanishing_argument_ =
         VanishingArgument<F>::Create(verifying_key_.constraint_system());
     return true;
   }
 
+  // The cache is written to a temporary file first and then moved to |path|,
+  // so that a concurrent reader never sees a partially written one.
+  bool WriteCache(const base::FilePath& path) const {
+    if (!base::CreateDirectory(path.DirName())) return false;
+    base::Uint8VectorBuffer buffer;
+    if (!buffer.WriteMany(kCacheVersion, verifying_key_.fixed_commitments(),
+                          verifying_key_.permutation_verifying_key()
+                              .commitments(),
+                          l_first_, l_last_, l_active_row_, fixed_polys_,
+                          permutation_proving_key_)) {
+      return false;
+    }
+    base::FilePath tmp_path;
+    if (!base::CreateTemporaryFileInDir(path.DirName(), &tmp_path)) {
+      return false;
+    }
+    if (!base::WriteLargeFile(tmp_path, buffer.owned_buffer()) ||
+        !base::Move(tmp_path, path)) {
+      base::DeleteFile(tmp_path);
+      return false;
+    }
+    return true;
+  }
+
   VerifyingKey<F, C> verifying_key_;
   Poly l_first_;
   Poly l_last_;
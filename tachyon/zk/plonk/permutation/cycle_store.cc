@@ -8,8 +8,24 @@
 
 #include <utility>
 
+#include "tachyon/base/openmp_util.h"
+
 namespace tachyon::zk::plonk {
 
+CycleStore::CycleStore(size_t cols, RowIndex rows) {
+  // Every label starts as a cycle of its own.
+  std::vector<std::vector<Label>> mapping(cols);
+  std::vector<std::vector<size_t>> sizes(cols);
+  OPENMP_PARALLEL_FOR(size_t col = 0; col < cols; ++col) {
+    mapping[col] = base::CreateVector(
+        rows, [col](RowIndex row) { return Label(col, row); });
+    sizes[col] = base::CreateVector(rows, size_t{1});
+  }
+  mapping_ = Table(std::move(mapping));
+  aux_ = mapping_;
+  sizes_ = Table(std::move(sizes));
+}
+
 bool CycleStore::MergeCycle(const Label& label, const Label& label2) {
   Label left_cycle_base = GetCycleBase(label);
   Label right_cycle_base = GetCycleBase(label2);
@@ -89,15 +89,7 @@ class TACHYON_EXPORT CycleStore {
   };
 
   CycleStore() = default;
-  CycleStore(size_t cols, RowIndex rows) {
-    mapping_ = Table(base::CreateVector(cols, [rows](size_t col) {
-      return base::CreateVector(
-          rows, [col](RowIndex row) { return Label(col, row); });
-    }));
-    aux_ = mapping_;
-    sizes_ =
-        Table(base::CreateVector(cols, base::CreateVector(rows, size_t{1})));
-  }
+  CycleStore(size_t cols, RowIndex rows);
 
   const Table<Label>& mapping() const { return mapping_; }
   const Table<Label>& aux() const { return aux_; }
@@ -93,12 +93,7 @@ class TACHYON_EXPORT PermutationAssembly {
     const Domain* domain = prover->domain();
 
     // The polynomials of permutations with coefficients.
-    std::vector<Poly> polys;
-    polys.reserve(columns_.size());
-    for (size_t i = 0; i < columns_.size(); ++i) {
-      Poly poly = domain->IFFT(permutations[i]);
-      polys.push_back(std::move(poly));
-    }
+    std::vector<Poly> polys = domain->IFFTs(permutations);
 
     return PermutationProvingKey<Poly, Evals>(std::move(permutations),
                                               std::move(polys));
@@ -88,12 +88,15 @@ void PermutationProver<Poly, Evals>::BatchCommitGrandProductPolys(
   if (permutation_provers.empty()) return;
 
   if constexpr (PCS::kSupportsBatchMode) {
+    std::vector<const Evals*> evals_list;
     for (const PermutationProver& permutation_prover : permutation_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
            permutation_prover.grand_product_polys_) {
-        prover->BatchCommitAt(grand_product_poly.evals(), commit_idx++);
+        evals_list.push_back(&grand_product_poly.evals());
       }
     }
+    prover->BatchCommitMultiAt(evals_list, commit_idx);
+    commit_idx += evals_list.size();
   } else {
     for (const PermutationProver& permutation_prover : permutation_provers) {
       for (const BlindedPolynomial<Poly, Evals>& grand_product_poly :
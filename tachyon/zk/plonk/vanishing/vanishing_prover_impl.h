@@ -118,9 +118,7 @@ void VanishingProver<Poly, Evals, ExtendedPoly,
         h_coeffs, n, [prover](absl::Span<const F> h_piece) {
           return prover->Commit(h_piece);
         });
-    for (const Commitment& commitment : commitments) {
-      CHECK(prover->GetWriter()->WriteToProof(commitment));
-    }
+    CHECK(prover->GetWriter()->WriteToProof(absl::MakeConstSpan(commitments)));
   }
 }
 
@@ -131,11 +129,12 @@ template <typename PCS, ColumnType C>
 void VanishingProver<Poly, Evals, ExtendedPoly, ExtendedEvals>::EvaluateColumns(
     ProverBase<PCS>* prover, const absl::Span<const Poly> polys,
     const std::vector<QueryData<C>>& queries, const F& x) {
-  for (const QueryData<C>& query : queries) {
-    const Poly& poly = polys[query.column().index()];
-    prover->EvaluateAndWriteToProof(
-        poly, query.rotation().RotateOmega(prover->domain(), x));
-  }
+  std::vector<F> evals =
+      base::Map(queries, [prover, polys, &x](const QueryData<C>& query) {
+        const Poly& poly = polys[query.column().index()];
+        return poly.Evaluate(query.rotation().RotateOmega(prover->domain(), x));
+      });
+  CHECK(prover->GetWriter()->WriteToProof(absl::MakeConstSpan(evals)));
 }
 
 template <typename Poly, typename Evals, typename ExtendedPoly,
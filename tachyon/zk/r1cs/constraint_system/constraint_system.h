@@ -18,6 +18,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/functional/callback.h"
 #include "tachyon/zk/r1cs/constraint_system/constraint_matrices.h"
+#include "tachyon/zk/r1cs/constraint_system/csr_constraint_matrices.h"
 #include "tachyon/zk/r1cs/constraint_system/linear_combination.h"
 #include "tachyon/zk/r1cs/constraint_system/optimization_goal.h"
 #include "tachyon/zk/r1cs/constraint_system/synthesis_mode.h"
@@ -397,6 +398,32 @@ class ConstraintSystem {
     return matrices;
   }
 
+  // Same as |ToMatrices()|, but the matrices are built in the CSR format.
+  // This step must be called after |Finalize()|.
+  std::optional<CSRConstraintMatrices<F>> ToCSRMatrices() const {
+    if (!mode_.ShouldConstructMatrices()) return std::nullopt;
+    CSRConstraintMatrices<F> matrices;
+    matrices.num_instance_variables = num_instance_variables_;
+    matrices.num_witness_variables = num_witness_variables_;
+    matrices.num_constraints = num_constraints_;
+    matrices.a = MakeCSRMatrix(a_constraints_);
+    matrices.b = MakeCSRMatrix(b_constraints_);
+    matrices.c = MakeCSRMatrix(c_constraints_);
+    return matrices;
+  }
+
+  // Returns z = (1, instance assignments..., witness assignments...), which is
+  // indexed in the same way as the columns of the constraint matrices.
+  std::vector<F> GetFullAssignments() const {
+    std::vector<F> ret;
+    ret.reserve(instance_assignments_.size() + witness_assignments_.size());
+    ret.insert(ret.end(), instance_assignments_.begin(),
+               instance_assignments_.end());
+    ret.insert(ret.end(), witness_assignments_.begin(),
+               witness_assignments_.end());
+    return ret;
+  }
+
   // Evaluate the linear combination corresponding to the |index|.
   F EvalLinearCombination(size_t index) const {
     auto it = lc_map_.find(index);
@@ -456,6 +483,35 @@ class ConstraintSystem {
     }));
   }
 
+  math::CSRSparseMatrix<F> MakeCSRMatrix(
+      const std::vector<size_t>& constraints) const {
+    using Elements = typename math::CSRSparseMatrix<F>::Elements;
+
+    std::vector<size_t> row_ptrs;
+    row_ptrs.reserve(constraints.size() + 1);
+    row_ptrs.push_back(0);
+    for (size_t index : constraints) {
+      auto it = lc_map_.find(index);
+      row_ptrs.push_back(row_ptrs.back() + it->second.terms().size());
+    }
+
+    // NOTE: The number of non-zero terms is not known until the terms are
+    // visited, so |row_ptrs| is an upper bound here and gets fixed below.
+    Elements elements;
+    elements.reserve(row_ptrs.back());
+    for (size_t i = 0; i < constraints.size(); ++i) {
+      auto it = lc_map_.find(constraints[i]);
+      for (const Term<F>& term : it->second.terms()) {
+        if (!term.coefficient.IsZero()) {
+          elements.push_back({*term.variable.GetIndex(num_instance_variables_),
+                              term.coefficient});
+        }
+      }
+      row_ptrs[i + 1] = elements.size();
+    }
+    return math::CSRSparseMatrix<F>(std::move(elements), std::move(row_ptrs));
+  }
+
   F DoEvalLinearCombination(const LinearCombination<F>& lc) const {
     return std::accumulate(lc.terms().begin(), lc.terms().end(), F::Zero(),
                            [this](F& acc, const Term<F>& term) {
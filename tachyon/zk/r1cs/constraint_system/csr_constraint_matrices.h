@@ -0,0 +1,60 @@
+#ifndef TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_CSR_CONSTRAINT_MATRICES_H_
+#define TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_CSR_CONSTRAINT_MATRICES_H_
+
+#include <stddef.h>
+
+#include <string>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/math/matrix/sparse/sparse_matrix.h"
+
+namespace tachyon::zk::r1cs {
+
+// Same as |ConstraintMatrices|, but the A, B and C matrices are stored in the
+// CSR format. Every matrix is kept in 2 flat vectors instead of a vector per
+// row, which is what the prover iterates over when computing A·z, B·z and C·z.
+template <typename F>
+struct CSRConstraintMatrices {
+  // The number of variables that are "public instances" to the constraint
+  // system.
+  size_t num_instance_variables = 0;
+  // The number of variables that are "private witnesses" to the constraint
+  // system.
+  size_t num_witness_variables = 0;
+  // The number of constraints in the constraint system.
+  size_t num_constraints = 0;
+
+  // The A constraint matrix.
+  math::CSRSparseMatrix<F> a;
+  // The B constraint matrix.
+  math::CSRSparseMatrix<F> b;
+  // The C constraint matrix.
+  math::CSRSparseMatrix<F> c;
+
+  size_t num_variables() const {
+    return num_instance_variables + num_witness_variables;
+  }
+
+  bool operator==(const CSRConstraintMatrices& other) const {
+    return num_instance_variables == other.num_instance_variables &&
+           num_witness_variables == other.num_witness_variables &&
+           num_constraints == other.num_constraints && a == other.a &&
+           b == other.b && c == other.c;
+  }
+  bool operator!=(const CSRConstraintMatrices& other) const {
+    return !operator==(other);
+  }
+
+  std::string ToString() const {
+    return absl::Substitute(
+        "{ num_instance_variables: $0, num_witness_variables: $1, "
+        "num_constraints: $2, a: $3, b: $4, c: $5 }",
+        num_instance_variables, num_witness_variables, num_constraints,
+        a.ToString(), b.ToString(), c.ToString());
+  }
+};
+
+}  // namespace tachyon::zk::r1cs
+
+#endif  // TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_CSR_CONSTRAINT_MATRICES_H_
@@ -0,0 +1,144 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_QUADRATIC_ARITHMETIC_PROGRAM_H_
+#define TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_QUADRATIC_ARITHMETIC_PROGRAM_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+#include "tachyon/zk/r1cs/constraint_system/csr_constraint_matrices.h"
+
+namespace tachyon::zk::r1cs {
+
+// Reduces a Rank-One |ConstraintSystem| to a Quadratic Arithmetic Program.
+// Besides the constraints, one extra constraint zᵢ * 0 = 0 is appended for
+// each instance variable zᵢ, so that the instance polynomials are linearly
+// independent. This follows the reduction used by libsnark and arkworks.
+template <typename F>
+class QuadraticArithmeticProgram {
+ public:
+  // Returns the number of evaluation points needed to reduce |matrices|.
+  static size_t GetDomainSize(const CSRConstraintMatrices<F>& matrices) {
+    return matrices.num_constraints + matrices.num_instance_variables;
+  }
+
+  // Evaluates the QAP polynomials aᵢ(X), bᵢ(X) and cᵢ(X) of every variable
+  // at |tau| and returns Z(|tau|), where Z(X) is the vanishing polynomial of
+  // |domain|. This is what the setup of a QAP based SNARK needs.
+  template <size_t MaxDegree>
+  static F InstanceMapWithEvaluation(
+      const math::UnivariateEvaluationDomain<F, MaxDegree>* domain,
+      const CSRConstraintMatrices<F>& matrices, const F& tau,
+      std::vector<F>* a, std::vector<F>* b, std::vector<F>* c) {
+    CHECK_GE(domain->size(), GetDomainSize(matrices));
+
+    // uᵢ = Lᵢ(τ), where Lᵢ(X) is the i-th lagrange basis polynomial.
+    std::vector<F> u = domain->EvaluateAllLagrangeCoefficients(tau);
+
+    size_t num_variables = matrices.num_variables();
+    *a = std::vector<F>(num_variables, F::Zero());
+    *b = std::vector<F>(num_variables, F::Zero());
+    *c = std::vector<F>(num_variables, F::Zero());
+
+    // See the extra constraints in the class comment.
+    for (size_t i = 0; i < matrices.num_instance_variables; ++i) {
+      (*a)[i] = u[matrices.num_constraints + i];
+    }
+    for (size_t i = 0; i < matrices.num_constraints; ++i) {
+      AddRow(matrices.a, i, u[i], a);
+      AddRow(matrices.b, i, u[i], b);
+      AddRow(matrices.c, i, u[i], c);
+    }
+    return domain->EvaluateVanishingPolynomial(tau);
+  }
+
+  // Computes the coefficients of H(X) = (A(X) * B(X) - C(X)) / Z(X), where
+  // A(X), B(X) and C(X) interpolate A·z, B·z and C·z over |domain| and Z(X)
+  // is the vanishing polynomial of |domain|. Z(X) vanishes on |domain|, so
+  // the division is done pointwise over a coset of |domain|, where Z(X) is a
+  // nonzero constant.
+  template <size_t MaxDegree>
+  static math::UnivariateDensePolynomial<F, MaxDegree> WitnessMap(
+      const math::UnivariateEvaluationDomain<F, MaxDegree>* domain,
+      const CSRConstraintMatrices<F>& matrices,
+      absl::Span<const F> full_assignments) {
+    using Domain = math::UnivariateEvaluationDomain<F, MaxDegree>;
+    using Evals = typename Domain::Evals;
+
+    size_t n = domain->size();
+    CHECK_GE(n, GetDomainSize(matrices));
+    CHECK_EQ(full_assignments.size(), matrices.num_variables());
+
+    F offset = F::FromMontgomery(F::Config::kSubgroupGenerator);
+    std::unique_ptr<Domain> coset_domain = domain->GetCoset(offset);
+
+    std::vector<F> a(n, F::Zero());
+    matrices.a.MulVector(full_assignments, absl::MakeSpan(a));
+    // Appends zᵢ * 0 = 0 for each instance variable zᵢ.
+    for (size_t i = 0; i < matrices.num_instance_variables; ++i) {
+      a[matrices.num_constraints + i] = full_assignments[i];
+    }
+    Evals ab = ToCosetEvals(domain, coset_domain.get(), std::move(a));
+
+    std::vector<F> b(n, F::Zero());
+    matrices.b.MulVector(full_assignments, absl::MakeSpan(b));
+    Evals b_evals = ToCosetEvals(domain, coset_domain.get(), std::move(b));
+
+    std::vector<F> c(n, F::Zero());
+    matrices.c.MulVector(full_assignments, absl::MakeSpan(c));
+    Evals c_evals = ToCosetEvals(domain, coset_domain.get(), std::move(c));
+
+    // Z(X) = Xⁿ - 1 on the coset is equal to offsetⁿ - 1 everywhere.
+    F vanishing_inv = domain->EvaluateVanishingPolynomial(offset).Inverse();
+
+    std::vector<F>& ab_evals = ab.evaluations();
+    const std::vector<F>& b_values = b_evals.evaluations();
+    const std::vector<F>& c_values = c_evals.evaluations();
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      ab_evals[i] *= b_values[i];
+      ab_evals[i] -= c_values[i];
+      ab_evals[i] *= vanishing_inv;
+    }
+    return coset_domain->IFFT(std::move(ab));
+  }
+
+ private:
+  // Adds |u| * M[|row|][j] to |ret|[j] for every nonzero entry of the |row|.
+  static void AddRow(const math::CSRSparseMatrix<F>& matrix, size_t row,
+                     const F& u, std::vector<F>* ret) {
+    const auto& elements = matrix.elements();
+    const std::vector<size_t>& row_ptrs = matrix.row_ptrs();
+    for (size_t j = row_ptrs[row]; j < row_ptrs[row + 1]; ++j) {
+      (*ret)[elements[j].index] += u * elements[j].value;
+    }
+  }
+
+  // Interpolates |values| over |domain| and evaluates the result over
+  // |coset_domain|.
+  template <typename Domain, typename Evals = typename Domain::Evals>
+  static Evals ToCosetEvals(const Domain* domain, const Domain* coset_domain,
+                            std::vector<F>&& values) {
+    size_t n = values.size();
+    Evals evals = coset_domain->FFT(domain->IFFT(Evals(std::move(values))));
+    // NOTE: |FFT()| returns empty evaluations for a zero polynomial.
+    if (evals.evaluations().empty()) {
+      evals.evaluations().resize(n, F::Zero());
+    }
+    return evals;
+  }
+};
+
+}  // namespace tachyon::zk::r1cs
+
+#endif  // TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_QUADRATIC_ARITHMETIC_PROGRAM_H_
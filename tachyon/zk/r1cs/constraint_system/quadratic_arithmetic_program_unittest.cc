@@ -0,0 +1,82 @@
+#include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/constraint_system/constraint_system.h"
+#include "tachyon/zk/r1cs/constraint_system/test/cubic_circuit.h"
+
+namespace tachyon::zk::r1cs {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = 31;
+
+using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+using DensePoly = math::UnivariateDensePolynomial<F, kMaxDegree>;
+using Evals = math::UnivariateEvaluations<F, kMaxDegree>;
+
+class QuadraticArithmeticProgramTest : public math::FiniteFieldTest<F> {};
+
+}  // namespace
+
+TEST_F(QuadraticArithmeticProgramTest, ToCSRMatrices) {
+  ConstraintSystem<F> constraint_system = BuildCubicConstraintSystem(F(3));
+  ConstraintMatrices<F> matrices = constraint_system.ToMatrices().value();
+  CSRConstraintMatrices<F> csr_matrices =
+      constraint_system.ToCSRMatrices().value();
+  EXPECT_EQ(csr_matrices.num_instance_variables,
+            matrices.num_instance_variables);
+  EXPECT_EQ(csr_matrices.num_witness_variables, matrices.num_witness_variables);
+  EXPECT_EQ(csr_matrices.num_constraints, matrices.num_constraints);
+  EXPECT_EQ(csr_matrices.a.NonZeros(), matrices.a_num_non_zero);
+  EXPECT_EQ(csr_matrices.b.NonZeros(), matrices.b_num_non_zero);
+  EXPECT_EQ(csr_matrices.c.NonZeros(), matrices.c_num_non_zero);
+
+  std::vector<F> z = constraint_system.GetFullAssignments();
+  std::vector<F> az = csr_matrices.a.MulVector(z);
+  std::vector<F> bz = csr_matrices.b.MulVector(z);
+  std::vector<F> cz = csr_matrices.c.MulVector(z);
+  for (size_t i = 0; i < csr_matrices.num_constraints; ++i) {
+    EXPECT_EQ(az[i] * bz[i], cz[i]);
+  }
+}
+
+TEST_F(QuadraticArithmeticProgramTest, WitnessMap) {
+  ConstraintSystem<F> constraint_system = BuildCubicConstraintSystem(F(3));
+  ASSERT_TRUE(constraint_system.IsSatisfied());
+  CSRConstraintMatrices<F> matrices = constraint_system.ToCSRMatrices().value();
+  std::vector<F> z = constraint_system.GetFullAssignments();
+
+  std::unique_ptr<Domain> domain = Domain::Create(
+      QuadraticArithmeticProgram<F>::GetDomainSize(matrices));
+  DensePoly h =
+      QuadraticArithmeticProgram<F>::WitnessMap(domain.get(), matrices, z);
+
+  auto interpolate = [&domain](const math::CSRSparseMatrix<F>& matrix,
+                               const std::vector<F>& assignments,
+                               size_t num_instance_variables = 0) {
+    std::vector<F> values(domain->size(), F::Zero());
+    matrix.MulVector(assignments, absl::MakeSpan(values));
+    for (size_t i = 0; i < num_instance_variables; ++i) {
+      values[matrix.MaxRows() + i] = assignments[i];
+    }
+    return domain->IFFT(Evals(std::move(values)));
+  };
+  DensePoly a = interpolate(matrices.a, z, matrices.num_instance_variables);
+  DensePoly b = interpolate(matrices.b, z);
+  DensePoly c = interpolate(matrices.c, z);
+
+  F tau = F::Random();
+  EXPECT_EQ(a.Evaluate(tau) * b.Evaluate(tau) - c.Evaluate(tau),
+            h.Evaluate(tau) * domain->EvaluateVanishingPolynomial(tau));
+}
+
+}  // namespace tachyon::zk::r1cs
@@ -0,0 +1,50 @@
+#ifndef TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_TEST_CUBIC_CIRCUIT_H_
+#define TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_TEST_CUBIC_CIRCUIT_H_
+
+#include "tachyon/zk/r1cs/constraint_system/constraint_system.h"
+
+namespace tachyon::zk::r1cs {
+
+// Returns x³ + x + 5, which is the public output of the circuit built by
+// |BuildCubicConstraintSystem()|.
+template <typename F>
+F ComputeCubicOutput(const F& x) {
+  return x.Square() * x + x + F(5);
+}
+
+// Builds a circuit proving knowledge of |x| such that x³ + x + 5 = out.
+template <typename F>
+ConstraintSystem<F> BuildCubicConstraintSystem(const F& x) {
+  ConstraintSystem<F> constraint_system;
+  F x_cube = x.Square() * x;
+  Variable out = constraint_system.CreateInstanceVariable(
+      [&x]() { return ComputeCubicOutput(x); });
+  Variable x_var =
+      constraint_system.CreateWitnessVariable([&x]() { return x; });
+  Variable x_square_var =
+      constraint_system.CreateWitnessVariable([&x]() { return x.Square(); });
+  Variable x_cube_var =
+      constraint_system.CreateWitnessVariable([&x_cube]() { return x_cube; });
+  // x * x = x²
+  constraint_system.EnforceConstraint(
+      LinearCombination<F>({{F(1), x_var}}),
+      LinearCombination<F>({{F(1), x_var}}),
+      LinearCombination<F>({{F(1), x_square_var}}));
+  // x² * x = x³
+  constraint_system.EnforceConstraint(
+      LinearCombination<F>({{F(1), x_square_var}}),
+      LinearCombination<F>({{F(1), x_var}}),
+      LinearCombination<F>({{F(1), x_cube_var}}));
+  // (x³ + x + 5) * 1 = out
+  constraint_system.EnforceConstraint(
+      LinearCombination<F>(
+          {{F(1), x_cube_var}, {F(1), x_var}, {F(5), Variable::One()}}),
+      LinearCombination<F>({{F(1), Variable::One()}}),
+      LinearCombination<F>({{F(1), out}}));
+  constraint_system.Finalize();
+  return constraint_system;
+}
+
+}  // namespace tachyon::zk::r1cs
+
+#endif  // TACHYON_ZK_R1CS_CONSTRAINT_SYSTEM_TEST_CUBIC_CIRCUIT_H_
@@ -0,0 +1,74 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/zk/r1cs/constraint_system/constraint_system.h"
+#include "tachyon/zk/r1cs/groth16/key_generator.h"
+#include "tachyon/zk/r1cs/groth16/prover.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+using Curve = math::bn254::BN254Curve;
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = (size_t{1} << 20) - 1;
+
+// Builds a circuit of |num_constraints| constraints, where every other
+// witness is a bit, as range checks and hash circuits usually produce.
+ConstraintSystem<F> BuildConstraintSystem(size_t num_constraints) {
+  ConstraintSystem<F> constraint_system;
+  F acc = F::Random();
+  Variable acc_var =
+      constraint_system.CreateInstanceVariable([&acc]() { return acc; });
+  for (size_t i = 0; i < num_constraints / 2; ++i) {
+    F bit = F(i % 2);
+    Variable bit_var =
+        constraint_system.CreateWitnessVariable([&bit]() { return bit; });
+    // bit * (bit - 1) = 0
+    constraint_system.EnforceConstraint(
+        LinearCombination<F>({{F(1), bit_var}}),
+        LinearCombination<F>({{F(1), bit_var}, {-F(1), Variable::One()}}),
+        LinearCombination<F>());
+    F next = acc.Square() + bit;
+    Variable next_var =
+        constraint_system.CreateWitnessVariable([&next]() { return next; });
+    // acc * acc = next - bit
+    constraint_system.EnforceConstraint(
+        LinearCombination<F>({{F(1), acc_var}}),
+        LinearCombination<F>({{F(1), acc_var}}),
+        LinearCombination<F>({{F(1), next_var}, {-F(1), bit_var}}));
+    acc = next;
+    acc_var = next_var;
+  }
+  constraint_system.Finalize();
+  return constraint_system;
+}
+
+void BM_Groth16Prove(benchmark::State& state) {
+  Curve::G1Curve::Init();
+  Curve::G2Curve::Init();
+  Curve::Init();
+
+  ConstraintSystem<F> constraint_system =
+      BuildConstraintSystem(static_cast<size_t>(state.range(0)));
+  CSRConstraintMatrices<F> matrices = constraint_system.ToCSRMatrices().value();
+  std::vector<F> full_assignments = constraint_system.GetFullAssignments();
+  ProvingKey<Curve> proving_key;
+  CHECK(GenerateRandomProvingKey<kMaxDegree>(matrices, &proving_key));
+
+  Prover<Curve, kMaxDegree> prover(&proving_key);
+  Proof<Curve> proof;
+  for (auto _ : state) {
+    CHECK(prover.Prove(matrices, full_assignments, &proof));
+  }
+  benchmark::DoNotOptimize(proof);
+}
+
+BENCHMARK(BM_Groth16Prove)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::zk::r1cs::groth16
+
@@ -0,0 +1,112 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/zk/r1cs/constraint_system/constraint_system.h"
+#include "tachyon/zk/r1cs/constraint_system/test/cubic_circuit.h"
+#include "tachyon/zk/r1cs/groth16/key_generator.h"
+#include "tachyon/zk/r1cs/groth16/prover.h"
+#include "tachyon/zk/r1cs/groth16/verifier.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+namespace {
+
+using Curve = math::bn254::BN254Curve;
+using F = math::bn254::Fr;
+
+constexpr size_t kMaxDegree = 31;
+
+class Groth16Test : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    Curve::G1Curve::Init();
+    Curve::G2Curve::Init();
+    Curve::Init();
+  }
+
+  void SetUp() override {
+    // Proves knowledge of x such that x³ + x + 5 = out.
+    F x(3);
+    constraint_system_ = BuildCubicConstraintSystem(x);
+    ASSERT_TRUE(constraint_system_.IsSatisfied());
+
+    matrices_ = constraint_system_.ToCSRMatrices().value();
+    full_assignments_ = constraint_system_.GetFullAssignments();
+    public_inputs_ = {ComputeCubicOutput(x)};
+    ASSERT_TRUE(
+        GenerateRandomProvingKey<kMaxDegree>(matrices_, &proving_key_));
+  }
+
+ protected:
+  ConstraintSystem<F> constraint_system_;
+  CSRConstraintMatrices<F> matrices_;
+  std::vector<F> full_assignments_;
+  std::vector<F> public_inputs_;
+  ProvingKey<Curve> proving_key_;
+};
+
+}  // namespace
+
+TEST_F(Groth16Test, ProveAndVerify) {
+  Prover<Curve, kMaxDegree> prover(&proving_key_);
+  Proof<Curve> proof;
+  ASSERT_TRUE(prover.Prove(matrices_, full_assignments_, &proof));
+
+  PreparedVerifyingKey<Curve> pvk(proving_key_.verifying_key());
+  EXPECT_TRUE(VerifyProof(pvk, proof, absl::MakeConstSpan(public_inputs_)));
+
+  std::vector<F> wrong_public_inputs = {public_inputs_[0] + F::One()};
+  EXPECT_FALSE(
+      VerifyProof(pvk, proof, absl::MakeConstSpan(wrong_public_inputs)));
+}
+
+TEST_F(Groth16Test, ThreadBudgetDoesNotChangeProof) {
+  F r = F::Random();
+  F s = F::Random();
+  Prover<Curve, kMaxDegree> prover(&proving_key_);
+  Proof<Curve> expected;
+  ASSERT_TRUE(prover.ProveWithRandomness(matrices_, full_assignments_, r, s,
+                                         &expected));
+
+  // The budgets split the MSMs into chunks, including ones that have more
+  // chunks than bases.
+  for (const MSMThreadBudget& thread_budget :
+       {MSMThreadBudget{1, 1, 2, 1, 1}, MSMThreadBudget{3, 2, 4, 5, 16}}) {
+    Prover<Curve, kMaxDegree> prover2(&proving_key_);
+    prover2.set_thread_budget(thread_budget);
+    Proof<Curve> proof;
+    ASSERT_TRUE(prover2.ProveWithRandomness(matrices_, full_assignments_, r, s,
+                                            &proof));
+    EXPECT_EQ(proof, expected);
+  }
+}
+
+TEST_F(Groth16Test, MapProvingKeyFromFile) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("proving_key");
+  ASSERT_TRUE(proving_key_.WriteToFile(path));
+
+  ProvingKey<Curve> mapped_proving_key;
+  ASSERT_TRUE(mapped_proving_key.MapFromFile(path));
+  EXPECT_TRUE(mapped_proving_key.IsMapped());
+  EXPECT_EQ(mapped_proving_key.verifying_key(), proving_key_.verifying_key());
+  EXPECT_EQ(mapped_proving_key.beta_g1(), proving_key_.beta_g1());
+  EXPECT_EQ(mapped_proving_key.delta_g1(), proving_key_.delta_g1());
+  EXPECT_EQ(mapped_proving_key.a_query(), proving_key_.a_query());
+  EXPECT_EQ(mapped_proving_key.b_g1_query(), proving_key_.b_g1_query());
+  EXPECT_EQ(mapped_proving_key.b_g2_query(), proving_key_.b_g2_query());
+  EXPECT_EQ(mapped_proving_key.h_query(), proving_key_.h_query());
+  EXPECT_EQ(mapped_proving_key.l_query(), proving_key_.l_query());
+
+  Prover<Curve, kMaxDegree> prover(&mapped_proving_key);
+  Proof<Curve> proof;
+  ASSERT_TRUE(prover.Prove(matrices_, full_assignments_, &proof));
+  PreparedVerifyingKey<Curve> pvk(mapped_proving_key.verifying_key());
+  EXPECT_TRUE(VerifyProof(pvk, proof, absl::MakeConstSpan(public_inputs_)));
+}
+
+}  // namespace tachyon::zk::r1cs::groth16
@@ -0,0 +1,120 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_ZK_R1CS_GROTH16_KEY_GENERATOR_H_
+#define TACHYON_ZK_R1CS_GROTH16_KEY_GENERATOR_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/constraint_system/csr_constraint_matrices.h"
+#include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
+#include "tachyon/zk/r1cs/groth16/proving_key.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// The trapdoor of the Groth16 setup. Anyone who knows it can forge proofs,
+// so it must be discarded once the keys are generated.
+template <typename F>
+struct ToxicWaste {
+  F alpha;
+  F beta;
+  F gamma;
+  F delta;
+  F tau;
+
+  static ToxicWaste Random() {
+    return {F::Random(), F::Random(), F::Random(), F::Random(), F::Random()};
+  }
+};
+
+// Generates the keys for |matrices| from |toxic_waste|.
+template <size_t MaxDegree, typename Curve,
+          typename F = typename Curve::G1Curve::AffinePoint::ScalarField>
+[[nodiscard]] bool GenerateProvingKey(const CSRConstraintMatrices<F>& matrices,
+                                      const ToxicWaste<F>& toxic_waste,
+                                      ProvingKey<Curve>* proving_key) {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using Domain = math::UnivariateEvaluationDomain<F, MaxDegree>;
+
+  std::unique_ptr<Domain> domain =
+      Domain::Create(QuadraticArithmeticProgram<F>::GetDomainSize(matrices));
+
+  std::vector<F> a;
+  std::vector<F> b;
+  std::vector<F> c;
+  F zt = QuadraticArithmeticProgram<F>::InstanceMapWithEvaluation(
+      domain.get(), matrices, toxic_waste.tau, &a, &b, &c);
+
+  F gamma_inv = toxic_waste.gamma.Inverse();
+  F delta_inv = toxic_waste.delta.Inverse();
+
+  // (β * aᵢ(τ) + α * bᵢ(τ) + cᵢ(τ)) / γ for instance variables and
+  // (β * aᵢ(τ) + α * bᵢ(τ) + cᵢ(τ)) / δ for witness variables.
+  size_t num_instance_variables = matrices.num_instance_variables;
+  std::vector<F> gamma_abc(num_instance_variables);
+  std::vector<F> l(matrices.num_witness_variables);
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < a.size(); ++i) {
+    F abc = toxic_waste.beta * a[i] + toxic_waste.alpha * b[i] + c[i];
+    if (i < num_instance_variables) {
+      gamma_abc[i] = abc * gamma_inv;
+    } else {
+      l[i - num_instance_variables] = abc * delta_inv;
+    }
+  }
+
+  // τⁱ * Z(τ) / δ for i in [0, n - 1), since deg(H) ≤ n - 2.
+  std::vector<F> h = F::GetSuccessivePowers(domain->size() - 1,
+                                            toxic_waste.tau, zt * delta_inv);
+
+  G1Point g1 = G1Point::Generator();
+  G2Point g2 = G2Point::Generator();
+
+  std::vector<G1Point> gamma_abc_g1(gamma_abc.size());
+  std::vector<G1Point> a_query(a.size());
+  std::vector<G1Point> b_g1_query(b.size());
+  std::vector<G2Point> b_g2_query(b.size());
+  std::vector<G1Point> h_query(h.size());
+  std::vector<G1Point> l_query(l.size());
+  if (!G1Point::BatchMapScalarFieldToPoint(g1, gamma_abc, &gamma_abc_g1) ||
+      !G1Point::BatchMapScalarFieldToPoint(g1, a, &a_query) ||
+      !G1Point::BatchMapScalarFieldToPoint(g1, b, &b_g1_query) ||
+      !G2Point::BatchMapScalarFieldToPoint(g2, b, &b_g2_query) ||
+      !G1Point::BatchMapScalarFieldToPoint(g1, h, &h_query) ||
+      !G1Point::BatchMapScalarFieldToPoint(g1, l, &l_query)) {
+    return false;
+  }
+
+  VerifyingKey<Curve> verifying_key(
+      (g1 * toxic_waste.alpha).ToAffine(), (g2 * toxic_waste.beta).ToAffine(),
+      (g2 * toxic_waste.gamma).ToAffine(), (g2 * toxic_waste.delta).ToAffine(),
+      std::move(gamma_abc_g1));
+  *proving_key = ProvingKey<Curve>(
+      std::move(verifying_key), (g1 * toxic_waste.beta).ToAffine(),
+      (g1 * toxic_waste.delta).ToAffine(), std::move(a_query),
+      std::move(b_g1_query), std::move(b_g2_query), std::move(h_query),
+      std::move(l_query));
+  return true;
+}
+
+// Generates the keys for |matrices| from a random |ToxicWaste|.
+template <size_t MaxDegree, typename Curve,
+          typename F = typename Curve::G1Curve::AffinePoint::ScalarField>
+[[nodiscard]] bool GenerateRandomProvingKey(
+    const CSRConstraintMatrices<F>& matrices, ProvingKey<Curve>* proving_key) {
+  return GenerateProvingKey<MaxDegree>(matrices, ToxicWaste<F>::Random(),
+                                       proving_key);
+}
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_KEY_GENERATOR_H_
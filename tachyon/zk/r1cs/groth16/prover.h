@@ -0,0 +1,275 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_ZK_R1CS_GROTH16_PROVER_H_
+#define TACHYON_ZK_R1CS_GROTH16_PROVER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/r1cs/constraint_system/csr_constraint_matrices.h"
+#include "tachyon/zk/r1cs/constraint_system/quadratic_arithmetic_program.h"
+#include "tachyon/zk/r1cs/groth16/proof.h"
+#include "tachyon/zk/r1cs/groth16/proving_key.h"
+#include "tachyon/zk/r1cs/groth16/witness_msm.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// The number of threads given to each of the MSMs of the prover. The MSMs
+// run concurrently, each with its own budget, instead of one after another
+// with all the threads: the bases of an MSM are split into as many chunks as
+// its budget and every chunk is summed on a thread of its own.
+struct MSMThreadBudget {
+  int a = 1;
+  int b_g1 = 1;
+  int b_g2 = 1;
+  int l = 1;
+  int h = 1;
+
+  // Splits |num_threads| among the MSMs in proportion to their sizes. A G2
+  // addition costs about 3 times as much as a G1 addition.
+  static MSMThreadBudget Create(int num_threads, size_t num_variables,
+                                size_t num_witness_variables, size_t h_size) {
+    size_t weights[] = {num_variables, num_variables, 3 * num_variables,
+                        num_witness_variables, h_size};
+    size_t total = 0;
+    for (size_t weight : weights) total += weight;
+    int budgets[5];
+    for (size_t i = 0; i < 5; ++i) {
+      budgets[i] =
+          total == 0 ? 1
+                     : std::max(1, static_cast<int>(num_threads * weights[i] /
+                                                    total));
+    }
+    return {budgets[0], budgets[1], budgets[2], budgets[3], budgets[4]};
+  }
+
+  static MSMThreadBudget CreateDefault(size_t num_variables,
+                                       size_t num_witness_variables,
+                                       size_t h_size) {
+#if defined(TACHYON_HAS_OPENMP)
+    int num_threads = omp_get_max_threads();
+#else
+    int num_threads = 1;
+#endif
+    return Create(num_threads, num_variables, num_witness_variables, h_size);
+  }
+};
+
+template <typename Curve, size_t MaxDegree>
+class Prover {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using F = typename G1Point::ScalarField;
+  using G1Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+  using G2Bucket = typename math::VariableBaseMSM<G2Point>::Bucket;
+  using Domain = math::UnivariateEvaluationDomain<F, MaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+
+  explicit Prover(const ProvingKey<Curve>* proving_key)
+      : proving_key_(proving_key) {}
+
+  const std::optional<MSMThreadBudget>& thread_budget() const {
+    return thread_budget_;
+  }
+  // If not set, the budget is computed by |MSMThreadBudget::CreateDefault()|.
+  void set_thread_budget(const MSMThreadBudget& thread_budget) {
+    thread_budget_ = thread_budget;
+  }
+
+  // Creates a proof that |full_assignments| satisfies |matrices|.
+  // |full_assignments| is z = (1, instance..., witness...), which can be
+  // obtained by |ConstraintSystem::GetFullAssignments()|.
+  [[nodiscard]] bool Prove(const CSRConstraintMatrices<F>& matrices,
+                           absl::Span<const F> full_assignments,
+                           Proof<Curve>* proof) const {
+    return ProveWithRandomness(matrices, full_assignments, F::Random(),
+                               F::Random(), proof);
+  }
+
+  [[nodiscard]] bool ProveWithRandomness(
+      const CSRConstraintMatrices<F>& matrices,
+      absl::Span<const F> full_assignments, const F& r, const F& s,
+      Proof<Curve>* proof) const {
+    if (full_assignments.size() != matrices.num_variables()) {
+      LOG(ERROR) << "full_assignments.size() and the number of variables "
+                    "don't match";
+      return false;
+    }
+    const ProvingKey<Curve>& pk = *proving_key_;
+    if (pk.a_query().size() != matrices.num_variables() ||
+        pk.l_query().size() != matrices.num_witness_variables) {
+      LOG(ERROR) << "The proving key doesn't match the constraint matrices";
+      return false;
+    }
+
+    std::unique_ptr<Domain> domain = Domain::Create(
+        QuadraticArithmeticProgram<F>::GetDomainSize(matrices));
+    DensePoly h = QuadraticArithmeticProgram<F>::WitnessMap(
+        domain.get(), matrices, full_assignments);
+    const std::vector<F>& h_coeffs = h.coefficients().coefficients();
+    size_t h_size = std::min(h_coeffs.size(), pk.h_query().size());
+
+    absl::Span<const F> witness_assignments =
+        full_assignments.subspan(matrices.num_instance_variables);
+
+    MSMThreadBudget thread_budget = thread_budget_.value_or(
+        MSMThreadBudget::CreateDefault(matrices.num_variables(),
+                                       matrices.num_witness_variables, h_size));
+    size_t num_chunks[] = {
+        static_cast<size_t>(std::max(1, thread_budget.a)),
+        static_cast<size_t>(std::max(1, thread_budget.b_g1)),
+        static_cast<size_t>(std::max(1, thread_budget.b_g2)),
+        static_cast<size_t>(std::max(1, thread_budget.l)),
+        static_cast<size_t>(std::max(1, thread_budget.h))};
+    // The chunks of the i-th MSM are the tasks in
+    // [|task_offsets[i]|, |task_offsets[i + 1]|).
+    size_t task_offsets[6] = {0};
+    for (size_t i = 0; i < 5; ++i) {
+      task_offsets[i + 1] = task_offsets[i] + num_chunks[i];
+    }
+    size_t num_tasks = task_offsets[5];
+
+    // NOTE: Every MSM but the one of B in G2 sums G1 points, so the partial
+    // sums of the G2 chunks are kept apart.
+    std::vector<G1Bucket> g1_sums(num_tasks - num_chunks[2]);
+    std::vector<G2Bucket> g2_sums(num_chunks[2]);
+    std::vector<uint8_t> results(num_tasks);
+    absl::Span<const F> h_scalars =
+        absl::MakeConstSpan(h_coeffs).subspan(0, h_size);
+    absl::Span<const G1Point> h_bases = pk.h_query().subspan(0, h_size);
+    // NOTE: The chunks are spread over a single parallel region with a thread
+    // per chunk instead of running the MSMs in nested parallel regions, so
+    // that no process-wide OpenMP setting is changed. The parallel loops of
+    // the MSMs inside a chunk run on its thread.
+#if defined(TACHYON_HAS_OPENMP)
+#pragma omp parallel for num_threads(static_cast<int>(num_tasks)) \
+    schedule(static, 1)
+#endif
+    for (size_t task = 0; task < num_tasks; ++task) {
+      size_t i = 0;
+      while (task >= task_offsets[i + 1]) ++i;
+      size_t chunk = task - task_offsets[i];
+      // The index of the partial sum in |g1_sums|.
+      size_t g1_index = i < 2 ? task : task - num_chunks[2];
+      switch (i) {
+        case 0:
+          results[task] = RunChunk<WitnessMSM<G1Point>>(
+              pk.a_query(), full_assignments, chunk, num_chunks[i],
+              &g1_sums[g1_index]);
+          break;
+        case 1:
+          results[task] = RunChunk<WitnessMSM<G1Point>>(
+              pk.b_g1_query(), full_assignments, chunk, num_chunks[i],
+              &g1_sums[g1_index]);
+          break;
+        case 2:
+          results[task] = RunChunk<WitnessMSM<G2Point>>(
+              pk.b_g2_query(), full_assignments, chunk, num_chunks[i],
+              &g2_sums[chunk]);
+          break;
+        case 3:
+          results[task] = RunChunk<WitnessMSM<G1Point>>(
+              pk.l_query(), witness_assignments, chunk, num_chunks[i],
+              &g1_sums[g1_index]);
+          break;
+        case 4:
+          results[task] = RunChunk<math::VariableBaseMSM<G1Point>>(
+              h_bases, h_scalars, chunk, num_chunks[i], &g1_sums[g1_index]);
+          break;
+      }
+    }
+    if (!std::all_of(results.begin(), results.end(),
+                     [](uint8_t result) { return result; })) {
+      return false;
+    }
+
+    auto sum_g1 = [&g1_sums, &num_chunks, &task_offsets](size_t i) {
+      size_t offset = i < 2 ? task_offsets[i] : task_offsets[i] - num_chunks[2];
+      G1Bucket sum = G1Bucket::Zero();
+      for (size_t j = 0; j < num_chunks[i]; ++j) {
+        sum += g1_sums[offset + j];
+      }
+      return sum;
+    };
+    G1Bucket a_acc = sum_g1(0);
+    G1Bucket b_g1_acc = sum_g1(1);
+    G2Bucket b_g2_acc = G2Bucket::Zero();
+    for (const G2Bucket& g2_sum : g2_sums) {
+      b_g2_acc += g2_sum;
+    }
+    G1Bucket l_acc = sum_g1(3);
+    G1Bucket h_acc = sum_g1(4);
+
+    const VerifyingKey<Curve>& vk = pk.verifying_key();
+    G1Bucket delta_g1 = pk.delta_g1().ToXYZZ();
+
+    // A = α + Σᵢ zᵢ * aᵢ(τ) + r * δ
+    G1Bucket g_a = a_acc;
+    g_a += vk.alpha_g1();
+    g_a += delta_g1 * r;
+
+    // B = β + Σᵢ zᵢ * bᵢ(τ) + s * δ
+    G1Bucket g1_b = b_g1_acc;
+    g1_b += pk.beta_g1();
+    g1_b += delta_g1 * s;
+    G2Bucket g2_b = b_g2_acc;
+    g2_b += vk.beta_g2();
+    g2_b += vk.delta_g2().ToXYZZ() * s;
+
+    // C = Σᵢ wᵢ * lᵢ + H(τ) * Z(τ) / δ + s * A + r * B - r * s * δ
+    G1Bucket g_c = l_acc;
+    g_c += h_acc;
+    g_c += g_a * s;
+    g_c += g1_b * r;
+    g_c -= delta_g1 * (r * s);
+
+    *proof = Proof<Curve>(g_a.ToAffine(), g2_b.ToAffine(), g_c.ToAffine());
+    return true;
+  }
+
+ private:
+  // Computes Σⱼ sⱼ * gⱼ over the |chunk_index|-th of the |num_chunks| chunks of
+  // |bases| and |scalars|.
+  template <typename MSM, typename Point, typename Bucket>
+  static bool RunChunk(absl::Span<const Point> bases,
+                       absl::Span<const F> scalars, size_t chunk_index,
+                       size_t num_chunks, Bucket* ret) {
+    if (bases.size() != scalars.size()) {
+      LOG(ERROR) << "bases.size() and scalars.size() don't match";
+      return false;
+    }
+    size_t begin = bases.size() * chunk_index / num_chunks;
+    size_t end = bases.size() * (chunk_index + 1) / num_chunks;
+    if (begin == end) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+    MSM msm;
+    return msm.Run(bases.subspan(begin, end - begin),
+                   scalars.subspan(begin, end - begin), ret);
+  }
+
+  // not owned
+  const ProvingKey<Curve>* const proving_key_;
+  std::optional<MSMThreadBudget> thread_budget_;
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_PROVER_H_
@@ -0,0 +1,297 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_ZK_R1CS_GROTH16_PROVING_KEY_H_
+#define TACHYON_ZK_R1CS_GROTH16_PROVING_KEY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/r1cs/groth16/verifying_key.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// The prover key for the Groth16 SNARK.
+//
+// The queries can either be owned by |this| or be views into a file mapped by
+// |MapFromFile()|. The file written by |WriteToFile()| stores every query as a
+// contiguous array of affine points in their in-memory representation, so the
+// prover reads the bases straight from the page cache without deserializing
+// or copying them. The layout is tied to the machine that wrote it.
+template <typename Curve>
+class ProvingKey {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+
+  static_assert(std::is_trivially_copyable_v<G1Point>);
+  static_assert(std::is_trivially_copyable_v<G2Point>);
+
+  ProvingKey() = default;
+  ProvingKey(VerifyingKey<Curve>&& verifying_key, const G1Point& beta_g1,
+             const G1Point& delta_g1, std::vector<G1Point>&& a_query,
+             std::vector<G1Point>&& b_g1_query,
+             std::vector<G2Point>&& b_g2_query,
+             std::vector<G1Point>&& h_query, std::vector<G1Point>&& l_query)
+      : verifying_key_(std::move(verifying_key)),
+        beta_g1_(beta_g1),
+        delta_g1_(delta_g1),
+        a_query_storage_(std::move(a_query)),
+        b_g1_query_storage_(std::move(b_g1_query)),
+        b_g2_query_storage_(std::move(b_g2_query)),
+        h_query_storage_(std::move(h_query)),
+        l_query_storage_(std::move(l_query)) {
+    a_query_ = a_query_storage_;
+    b_g1_query_ = b_g1_query_storage_;
+    b_g2_query_ = b_g2_query_storage_;
+    h_query_ = h_query_storage_;
+    l_query_ = l_query_storage_;
+  }
+  // NOTE: Moving a |std::vector| keeps its buffer, so the views stay valid.
+  ProvingKey(ProvingKey&& other) = default;
+  ProvingKey& operator=(ProvingKey&& other) = default;
+  ProvingKey(const ProvingKey& other) = delete;
+  ProvingKey& operator=(const ProvingKey& other) = delete;
+
+  const VerifyingKey<Curve>& verifying_key() const { return verifying_key_; }
+  // β * G1
+  const G1Point& beta_g1() const { return beta_g1_; }
+  // δ * G1
+  const G1Point& delta_g1() const { return delta_g1_; }
+  // aᵢ(τ) * G1
+  absl::Span<const G1Point> a_query() const { return a_query_; }
+  // bᵢ(τ) * G1
+  absl::Span<const G1Point> b_g1_query() const { return b_g1_query_; }
+  // bᵢ(τ) * G2
+  absl::Span<const G2Point> b_g2_query() const { return b_g2_query_; }
+  // τⁱ * Z(τ) / δ * G1
+  absl::Span<const G1Point> h_query() const { return h_query_; }
+  // (β * aᵢ(τ) + α * bᵢ(τ) + cᵢ(τ)) / δ * G1, where i is the index of a
+  // witness variable.
+  absl::Span<const G1Point> l_query() const { return l_query_; }
+
+  bool IsMapped() const { return mapped_file_ != nullptr; }
+
+  [[nodiscard]] bool WriteToFile(const base::FilePath& path) const {
+    base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                              base::File::FLAG_WRITE);
+    if (!file.IsValid()) {
+      LOG(ERROR) << "Failed to open " << path.value();
+      return false;
+    }
+
+    Header header = CreateHeader();
+    const G1Point g1_points[] = {verifying_key_.alpha_g1(), beta_g1_,
+                                 delta_g1_};
+    const G2Point g2_points[] = {verifying_key_.beta_g2(),
+                                 verifying_key_.gamma_g2(),
+                                 verifying_key_.delta_g2()};
+    Writer writer(&file);
+    return writer.Write(&header, 1) && writer.Write(g1_points, 3) &&
+           writer.Write(g2_points, 3) &&
+           writer.Write(verifying_key_.gamma_abc_g1().data(),
+                        verifying_key_.gamma_abc_g1().size()) &&
+           writer.Write(a_query_.data(), a_query_.size()) &&
+           writer.Write(b_g1_query_.data(), b_g1_query_.size()) &&
+           writer.Write(b_g2_query_.data(), b_g2_query_.size()) &&
+           writer.Write(h_query_.data(), h_query_.size()) &&
+           writer.Write(l_query_.data(), l_query_.size());
+  }
+
+  // Maps a file written by |WriteToFile()|. The queries are views into the
+  // mapping, which lives as long as |this|.
+  [[nodiscard]] bool MapFromFile(const base::FilePath& path) {
+    std::unique_ptr<base::MemoryMappedFile> mapped_file(
+        new base::MemoryMappedFile());
+    if (!mapped_file->Initialize(path)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return false;
+    }
+
+    Reader reader(mapped_file->bytes());
+    const Header* header = reader.template Read<Header>(1);
+    if (header == nullptr) return false;
+    Header expected = CreateHeader();
+    if (memcmp(header->magic, expected.magic, sizeof(expected.magic)) != 0 ||
+        header->version != expected.version ||
+        header->g1_size != expected.g1_size ||
+        header->g2_size != expected.g2_size) {
+      LOG(ERROR) << "Unsupported proving key layout";
+      return false;
+    }
+
+    const G1Point* g1_points = reader.template Read<G1Point>(3);
+    const G2Point* g2_points = reader.template Read<G2Point>(3);
+    const G1Point* gamma_abc_g1 =
+        reader.template Read<G1Point>(header->gamma_abc_g1_len);
+    const G1Point* a_query = reader.template Read<G1Point>(header->a_query_len);
+    const G1Point* b_g1_query =
+        reader.template Read<G1Point>(header->b_g1_query_len);
+    const G2Point* b_g2_query =
+        reader.template Read<G2Point>(header->b_g2_query_len);
+    const G1Point* h_query = reader.template Read<G1Point>(header->h_query_len);
+    const G1Point* l_query = reader.template Read<G1Point>(header->l_query_len);
+    if (l_query == nullptr) {
+      LOG(ERROR) << "Proving key file is truncated";
+      return false;
+    }
+
+    verifying_key_ = VerifyingKey<Curve>(
+        g1_points[0], g2_points[0], g2_points[1], g2_points[2],
+        std::vector<G1Point>(gamma_abc_g1,
+                             gamma_abc_g1 + header->gamma_abc_g1_len));
+    beta_g1_ = g1_points[1];
+    delta_g1_ = g1_points[2];
+    a_query_ = absl::MakeConstSpan(a_query, header->a_query_len);
+    b_g1_query_ = absl::MakeConstSpan(b_g1_query, header->b_g1_query_len);
+    b_g2_query_ = absl::MakeConstSpan(b_g2_query, header->b_g2_query_len);
+    h_query_ = absl::MakeConstSpan(h_query, header->h_query_len);
+    l_query_ = absl::MakeConstSpan(l_query, header->l_query_len);
+
+    a_query_storage_.clear();
+    b_g1_query_storage_.clear();
+    b_g2_query_storage_.clear();
+    h_query_storage_.clear();
+    l_query_storage_.clear();
+    mapped_file_ = std::move(mapped_file);
+    return true;
+  }
+
+ private:
+  // Every section starts at a multiple of |kAlignment|.
+  constexpr static size_t kAlignment = 64;
+  constexpr static uint32_t kVersion = 1;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t g1_size;
+    uint32_t g2_size;
+    uint32_t reserved;
+    uint64_t gamma_abc_g1_len;
+    uint64_t a_query_len;
+    uint64_t b_g1_query_len;
+    uint64_t b_g2_query_len;
+    uint64_t h_query_len;
+    uint64_t l_query_len;
+  };
+
+  class Writer {
+   public:
+    explicit Writer(base::File* file) : file_(file) {}
+
+    template <typename T>
+    [[nodiscard]] bool Write(const T* data, size_t len) {
+      // NOTE: |base::File| takes an int as a size, so the data is written in
+      // chunks of at most 1GiB.
+      constexpr size_t kMaxChunkSize = size_t{1} << 30;
+      const char* ptr = reinterpret_cast<const char*>(data);
+      size_t remaining = len * sizeof(T);
+      while (remaining > 0) {
+        int size = static_cast<int>(std::min(remaining, kMaxChunkSize));
+        if (file_->WriteAtCurrentPos(ptr, size) != size) return false;
+        ptr += size;
+        remaining -= size;
+        offset_ += size;
+      }
+      size_t padding = AlignUp(offset_) - offset_;
+      if (padding > 0) {
+        char zeros[kAlignment] = {0};
+        int size = static_cast<int>(padding);
+        if (file_->WriteAtCurrentPos(zeros, size) != size) return false;
+        offset_ += padding;
+      }
+      return true;
+    }
+
+   private:
+    // not owned
+    base::File* const file_;
+    size_t offset_ = 0;
+  };
+
+  class Reader {
+   public:
+    explicit Reader(absl::Span<const uint8_t> bytes) : bytes_(bytes) {}
+
+    // Returns nullptr if |bytes_| is too short or a previous read failed.
+    template <typename T>
+    const T* Read(size_t len) {
+      if (failed_) return nullptr;
+      size_t size = len * sizeof(T);
+      if (len != 0 && size / len != sizeof(T)) {
+        failed_ = true;
+        return nullptr;
+      }
+      if (bytes_.size() - offset_ < size) {
+        failed_ = true;
+        return nullptr;
+      }
+      const T* ret = reinterpret_cast<const T*>(bytes_.data() + offset_);
+      offset_ = std::min(AlignUp(offset_ + size), bytes_.size());
+      return ret;
+    }
+
+   private:
+    absl::Span<const uint8_t> bytes_;
+    size_t offset_ = 0;
+    bool failed_ = false;
+  };
+
+  static size_t AlignUp(size_t offset) {
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  Header CreateHeader() const {
+    Header header;
+    memset(&header, 0, sizeof(Header));
+    memcpy(header.magic, "TCHGR16", 8);
+    header.version = kVersion;
+    header.g1_size = sizeof(G1Point);
+    header.g2_size = sizeof(G2Point);
+    header.gamma_abc_g1_len = verifying_key_.gamma_abc_g1().size();
+    header.a_query_len = a_query_.size();
+    header.b_g1_query_len = b_g1_query_.size();
+    header.b_g2_query_len = b_g2_query_.size();
+    header.h_query_len = h_query_.size();
+    header.l_query_len = l_query_.size();
+    return header;
+  }
+
+  VerifyingKey<Curve> verifying_key_;
+  G1Point beta_g1_;
+  G1Point delta_g1_;
+  absl::Span<const G1Point> a_query_;
+  absl::Span<const G1Point> b_g1_query_;
+  absl::Span<const G2Point> b_g2_query_;
+  absl::Span<const G1Point> h_query_;
+  absl::Span<const G1Point> l_query_;
+
+  // Storages for the queries when |this| is not mapped from a file.
+  std::vector<G1Point> a_query_storage_;
+  std::vector<G1Point> b_g1_query_storage_;
+  std::vector<G2Point> b_g2_query_storage_;
+  std::vector<G1Point> h_query_storage_;
+  std::vector<G1Point> l_query_storage_;
+
+  std::unique_ptr<base::MemoryMappedFile> mapped_file_;
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_PROVING_KEY_H_
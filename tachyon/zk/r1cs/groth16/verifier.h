@@ -0,0 +1,60 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_ZK_R1CS_GROTH16_VERIFIER_H_
+#define TACHYON_ZK_R1CS_GROTH16_VERIFIER_H_
+
+#include <array>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+#include "tachyon/zk/r1cs/groth16/proof.h"
+#include "tachyon/zk/r1cs/groth16/verifying_key.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// Returns true if |proof| is valid for |public_inputs|. |public_inputs| are
+// the instance assignments without the leading 1.
+//
+// It checks e(A, B) = e(α, β) * e(Σᵢ xᵢ * γ_abcᵢ, γ) * e(C, δ) as
+// e(A, B) * e(-α, β) * e(-Σᵢ xᵢ * γ_abcᵢ, γ) * e(-C, δ) = 1, so that a single
+// multi miller loop and a single final exponentiation are needed.
+template <typename Curve,
+          typename F = typename Curve::G1Curve::AffinePoint::ScalarField>
+[[nodiscard]] bool VerifyProof(const PreparedVerifyingKey<Curve>& pvk,
+                               const Proof<Curve>& proof,
+                               absl::Span<const F> public_inputs) {
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+
+  const std::vector<G1Point>& gamma_abc_g1 = pvk.gamma_abc_g1();
+  if (public_inputs.size() + 1 != gamma_abc_g1.size()) {
+    LOG(ERROR) << "public_inputs.size() doesn't match the verifying key";
+    return false;
+  }
+
+  math::VariableBaseMSM<G1Point> msm;
+  Bucket prepared_inputs;
+  if (!msm.Run(absl::MakeConstSpan(gamma_abc_g1).subspan(1), public_inputs,
+               &prepared_inputs)) {
+    return false;
+  }
+  prepared_inputs += gamma_abc_g1[0];
+
+  std::array<G1Point, 4> g1s = {proof.a(), pvk.neg_alpha_g1(),
+                                -prepared_inputs.ToAffine(), -proof.c()};
+  std::array<G2Prepared, 4> g2s = {G2Prepared::From(proof.b()), pvk.beta_g2(),
+                                   pvk.gamma_g2(), pvk.delta_g2()};
+  return math::Pairing<Curve>(g1s, g2s).IsOne();
+}
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_VERIFIER_H_
@@ -0,0 +1,93 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_ZK_R1CS_GROTH16_VERIFYING_KEY_H_
+#define TACHYON_ZK_R1CS_GROTH16_VERIFYING_KEY_H_
+
+#include <utility>
+#include <vector>
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// A verification key in the Groth16 SNARK.
+template <typename Curve>
+class VerifyingKey {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+
+  VerifyingKey() = default;
+  VerifyingKey(const G1Point& alpha_g1, const G2Point& beta_g2,
+               const G2Point& gamma_g2, const G2Point& delta_g2,
+               std::vector<G1Point>&& gamma_abc_g1)
+      : alpha_g1_(alpha_g1),
+        beta_g2_(beta_g2),
+        gamma_g2_(gamma_g2),
+        delta_g2_(delta_g2),
+        gamma_abc_g1_(std::move(gamma_abc_g1)) {}
+
+  const G1Point& alpha_g1() const { return alpha_g1_; }
+  const G2Point& beta_g2() const { return beta_g2_; }
+  const G2Point& gamma_g2() const { return gamma_g2_; }
+  const G2Point& delta_g2() const { return delta_g2_; }
+  const std::vector<G1Point>& gamma_abc_g1() const { return gamma_abc_g1_; }
+
+  bool operator==(const VerifyingKey& other) const {
+    return alpha_g1_ == other.alpha_g1_ && beta_g2_ == other.beta_g2_ &&
+           gamma_g2_ == other.gamma_g2_ && delta_g2_ == other.delta_g2_ &&
+           gamma_abc_g1_ == other.gamma_abc_g1_;
+  }
+  bool operator!=(const VerifyingKey& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  // α * G1
+  G1Point alpha_g1_;
+  // β * G2
+  G2Point beta_g2_;
+  // γ * G2
+  G2Point gamma_g2_;
+  // δ * G2
+  G2Point delta_g2_;
+  // (β * aᵢ(τ) + α * bᵢ(τ) + cᵢ(τ)) / γ * G1, where i is the index of an
+  // instance variable.
+  std::vector<G1Point> gamma_abc_g1_;
+};
+
+// Preprocessed verification key, which is what |Verify()| consumes. The G2
+// points are prepared once so that verifying a proof only needs a single
+// multi miller loop over 4 pairs and a single final exponentiation.
+template <typename Curve>
+class PreparedVerifyingKey {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+
+  PreparedVerifyingKey() = default;
+  explicit PreparedVerifyingKey(const VerifyingKey<Curve>& verifying_key)
+      : neg_alpha_g1_(-verifying_key.alpha_g1()),
+        beta_g2_(G2Prepared::From(verifying_key.beta_g2())),
+        gamma_g2_(G2Prepared::From(verifying_key.gamma_g2())),
+        delta_g2_(G2Prepared::From(verifying_key.delta_g2())),
+        gamma_abc_g1_(verifying_key.gamma_abc_g1()) {}
+
+  const G1Point& neg_alpha_g1() const { return neg_alpha_g1_; }
+  const G2Prepared& beta_g2() const { return beta_g2_; }
+  const G2Prepared& gamma_g2() const { return gamma_g2_; }
+  const G2Prepared& delta_g2() const { return delta_g2_; }
+  const std::vector<G1Point>& gamma_abc_g1() const { return gamma_abc_g1_; }
+
+ private:
+  G1Point neg_alpha_g1_;
+  G2Prepared beta_g2_;
+  G2Prepared gamma_g2_;
+  G2Prepared delta_g2_;
+  std::vector<G1Point> gamma_abc_g1_;
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_VERIFYING_KEY_H_
@@ -0,0 +1,98 @@
+#ifndef TACHYON_ZK_R1CS_GROTH16_WITNESS_MSM_H_
+#define TACHYON_ZK_R1CS_GROTH16_WITNESS_MSM_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+// |WitnessMSM| computes Σᵢ sᵢ * gᵢ for witness assignments. Circuits with many
+// boolean or unused wires produce assignments where most of the scalars are 0
+// or 1. Zeros are skipped, bases whose scalar is 1 are summed directly and
+// only the rest is passed to |VariableBaseMSM|.
+template <typename Point>
+class WitnessMSM {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename math::VariableBaseMSM<Point>::Bucket;
+
+  // If less than 1 / |kMinTrivialRatio| of the scalars are 0 or 1, the fast
+  // path is not worth compacting the inputs.
+  constexpr static size_t kMinTrivialRatio = 8;
+
+  [[nodiscard]] static bool Run(absl::Span<const Point> bases,
+                                absl::Span<const ScalarField> scalars,
+                                Bucket* ret) {
+    if (bases.size() != scalars.size()) {
+      LOG(ERROR) << "bases.size() and scalars.size() don't match";
+      return false;
+    }
+
+    struct Chunk {
+      Bucket ones_sum = Bucket::Zero();
+      std::vector<size_t> dense_indices;
+      size_t num_trivials = 0;
+    };
+
+    std::vector<Chunk> chunks = base::ParallelizeMap(
+        scalars, [bases](absl::Span<const ScalarField> chunk,
+                         size_t chunk_index, size_t chunk_size) {
+          Chunk ret;
+          size_t offset = chunk_index * chunk_size;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            if (chunk[i].IsZero()) {
+              ++ret.num_trivials;
+            } else if (chunk[i].IsOne()) {
+              ret.ones_sum += bases[offset + i];
+              ++ret.num_trivials;
+            } else {
+              ret.dense_indices.push_back(offset + i);
+            }
+          }
+          return ret;
+        });
+
+    size_t num_trivials = std::accumulate(
+        chunks.begin(), chunks.end(), size_t{0},
+        [](size_t acc, const Chunk& chunk) { return acc + chunk.num_trivials; });
+    math::VariableBaseMSM<Point> msm;
+    if (num_trivials * kMinTrivialRatio < scalars.size()) {
+      return msm.Run(bases, scalars, ret);
+    }
+
+    std::vector<size_t> offsets(chunks.size() + 1, 0);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets[i + 1] = offsets[i] + chunks[i].dense_indices.size();
+    }
+    std::vector<Point> dense_bases(offsets.back());
+    std::vector<ScalarField> dense_scalars(offsets.back());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < chunks.size(); ++i) {
+      const std::vector<size_t>& indices = chunks[i].dense_indices;
+      for (size_t j = 0; j < indices.size(); ++j) {
+        dense_bases[offsets[i] + j] = bases[indices[j]];
+        dense_scalars[offsets[i] + j] = scalars[indices[j]];
+      }
+    }
+
+    Bucket dense_sum;
+    if (!msm.Run(dense_bases, dense_scalars, &dense_sum)) return false;
+    *ret = std::accumulate(chunks.begin(), chunks.end(), std::move(dense_sum),
+                           [](Bucket& acc, const Chunk& chunk) {
+                             return acc += chunk.ones_sum;
+                           });
+    return true;
+  }
+};
+
+}  // namespace tachyon::zk::r1cs::groth16
+
+#endif  // TACHYON_ZK_R1CS_GROTH16_WITNESS_MSM_H_
@@ -0,0 +1,71 @@
+#include "tachyon/zk/r1cs/groth16/witness_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::zk::r1cs::groth16 {
+
+namespace {
+
+using G1Point = math::bn254::G1AffinePoint;
+using F = math::bn254::Fr;
+using Bucket = WitnessMSM<G1Point>::Bucket;
+
+class WitnessMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { math::bn254::G1Curve::Init(); }
+};
+
+Bucket ComputeExpected(const std::vector<G1Point>& bases,
+                       const std::vector<F>& scalars) {
+  math::VariableBaseMSM<G1Point> msm;
+  Bucket ret;
+  CHECK(msm.Run(bases, scalars, &ret));
+  return ret;
+}
+
+}  // namespace
+
+TEST_F(WitnessMSMTest, Run) {
+  constexpr size_t kSize = 1000;
+  std::vector<G1Point> bases =
+      base::CreateVector(kSize, []() { return G1Point::Random(); });
+
+  // Dense scalars take the plain MSM path.
+  std::vector<F> dense_scalars =
+      base::CreateVector(kSize, []() { return F::Random(); });
+  // Boolean-heavy scalars take the fast path.
+  std::vector<F> sparse_scalars = base::CreateVector(kSize, []() {
+    switch (base::Uniform(base::Range<int>(0, 4))) {
+      case 0:
+        return F::Random();
+      case 1:
+        return F::One();
+      default:
+        return F::Zero();
+    }
+  });
+  std::vector<F> zero_scalars(kSize, F::Zero());
+  std::vector<F> one_scalars(kSize, F::One());
+
+  for (const std::vector<F>* scalars :
+       {&dense_scalars, &sparse_scalars, &zero_scalars, &one_scalars}) {
+    Bucket ret;
+    ASSERT_TRUE(WitnessMSM<G1Point>::Run(bases, *scalars, &ret));
+    EXPECT_EQ(ret, ComputeExpected(bases, *scalars));
+  }
+}
+
+TEST_F(WitnessMSMTest, SizeMismatch) {
+  std::vector<G1Point> bases = {G1Point::Random()};
+  std::vector<F> scalars = {F::One(), F::One()};
+  Bucket ret;
+  EXPECT_FALSE(WitnessMSM<G1Point>::Run(bases, scalars, &ret));
+}
+
+}  // namespace tachyon::zk::r1cs::groth16
@@ -6,6 +6,8 @@
 #include <memory>
 #include <utility>
 
+#include "rust/cxx.h"
+
 #include "tachyon/c/math/polynomials/univariate/bn254_univariate_rational_evaluations.h"
 
 namespace tachyon::halo2_api::bn254 {
@@ -34,6 +36,10 @@ class RationalEvals {
   void set_zero(size_t idx);
   void set_trivial(size_t idx, const Fr& numerator);
   void set_rational(size_t idx, const Fr& numerator, const Fr& denominator);
+  void set_zeros(size_t offset, size_t len);
+  void set_trivials(size_t offset, rust::Slice<const Fr> numerators);
+  void set_rationals(size_t offset, rust::Slice<const Fr> numerators,
+                     rust::Slice<const Fr> denominators);
   std::unique_ptr<RationalEvals> clone() const;
 
  private:
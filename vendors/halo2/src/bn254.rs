@@ -120,6 +120,14 @@ pub mod ffi {
             numerator: &Fr,
             denominator: &Fr,
         );
+        fn set_zeros(self: Pin<&mut RationalEvals>, offset: usize, len: usize);
+        fn set_trivials(self: Pin<&mut RationalEvals>, offset: usize, numerators: &[Fr]);
+        fn set_rationals(
+            self: Pin<&mut RationalEvals>,
+            offset: usize,
+            numerators: &[Fr],
+            denominators: &[Fr],
+        );
         fn clone(&self) -> UniquePtr<RationalEvals>;
     }
 
@@ -386,6 +394,29 @@ impl RationalEvals {
             .pin_mut()
             .set_rational(idx, cpp_numerator, cpp_denominator)
     }
+
+    pub fn set_zeros(&mut self, offset: usize, len: usize) {
+        self.inner.pin_mut().set_zeros(offset, len)
+    }
+
+    pub fn set_trivials(&mut self, offset: usize, numerators: &[halo2curves::bn256::Fr]) {
+        let cpp_numerators = unsafe { std::mem::transmute::<_, &[Fr]>(numerators) };
+        self.inner.pin_mut().set_trivials(offset, cpp_numerators)
+    }
+
+    pub fn set_rationals(
+        &mut self,
+        offset: usize,
+        numerators: &[halo2curves::bn256::Fr],
+        denominators: &[halo2curves::bn256::Fr],
+    ) {
+        assert_eq!(numerators.len(), denominators.len());
+        let cpp_numerators = unsafe { std::mem::transmute::<_, &[Fr]>(numerators) };
+        let cpp_denominators = unsafe { std::mem::transmute::<_, &[Fr]>(denominators) };
+        self.inner
+            .pin_mut()
+            .set_rationals(offset, cpp_numerators, cpp_denominators)
+    }
 }
 
 impl Clone for RationalEvals {
@@ -31,6 +31,28 @@ void RationalEvals::set_rational(size_t idx, const Fr& numerator,
       reinterpret_cast<const tachyon_bn254_fr*>(&denominator));
 }
 
+void RationalEvals::set_zeros(size_t offset, size_t len) {
+  tachyon_bn254_univariate_rational_evaluations_set_zeros(evals_, offset, len);
+}
+
+void RationalEvals::set_trivials(size_t offset,
+                                 rust::Slice<const Fr> numerators) {
+  tachyon_bn254_univariate_rational_evaluations_set_trivials(
+      evals_, offset,
+      reinterpret_cast<const tachyon_bn254_fr*>(numerators.data()),
+      numerators.size());
+}
+
+void RationalEvals::set_rationals(size_t offset,
+                                  rust::Slice<const Fr> numerators,
+                                  rust::Slice<const Fr> denominators) {
+  tachyon_bn254_univariate_rational_evaluations_set_rationals(
+      evals_, offset,
+      reinterpret_cast<const tachyon_bn254_fr*>(numerators.data()),
+      reinterpret_cast<const tachyon_bn254_fr*>(denominators.data()),
+      numerators.size());
+}
+
 std::unique_ptr<RationalEvals> RationalEvals::clone() const {
   return std::make_unique<RationalEvals>(
       tachyon_bn254_univariate_rational_evaluations_clone(evals_));
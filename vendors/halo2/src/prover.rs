@@ -90,16 +90,109 @@ pub fn create_proof<'params, W: Write, ConcreteCircuit: Circuit<Fr>>(
         })
         .collect::<Result<Vec<_>, _>>()?;
 
+    /// Consecutive cells of an advice column that are assigned with the same
+    /// kind of value, which are handed over to the column in a single call.
+    enum Run {
+        Zeros(usize),
+        Trivials(Vec<Fr>),
+        Rationals(Vec<Fr>, Vec<Fr>),
+    }
+
+    impl Run {
+        fn len(&self) -> usize {
+            match self {
+                Run::Zeros(len) => *len,
+                Run::Trivials(numerators) => numerators.len(),
+                Run::Rationals(numerators, _) => numerators.len(),
+            }
+        }
+    }
+
+    #[derive(Default)]
+    struct PendingRun {
+        offset: usize,
+        run: Option<Run>,
+    }
+
+    impl PendingRun {
+        fn push<F: Field>(
+            &mut self,
+            rational_evals: &mut RationalEvals,
+            row: usize,
+            value: &Assigned<F>,
+        ) {
+            let extends = match (&self.run, value) {
+                (Some(run), _) if self.offset + run.len() != row => false,
+                (Some(Run::Zeros(_)), Assigned::Zero) => true,
+                (Some(Run::Trivials(_)), Assigned::Trivial(_)) => true,
+                (Some(Run::Rationals(_, _)), Assigned::Rational(_, _)) => true,
+                _ => false,
+            };
+            if !extends {
+                self.flush(rational_evals);
+                self.offset = row;
+            }
+            match value {
+                Assigned::Zero => match &mut self.run {
+                    Some(Run::Zeros(len)) => *len += 1,
+                    _ => self.run = Some(Run::Zeros(1)),
+                },
+                Assigned::Trivial(numerator) => {
+                    let numerator = *unsafe { std::mem::transmute::<_, &Fr>(numerator) };
+                    match &mut self.run {
+                        Some(Run::Trivials(numerators)) => numerators.push(numerator),
+                        _ => self.run = Some(Run::Trivials(vec![numerator])),
+                    }
+                }
+                Assigned::Rational(numerator, denominator) => {
+                    let numerator = *unsafe { std::mem::transmute::<_, &Fr>(numerator) };
+                    let denominator = *unsafe { std::mem::transmute::<_, &Fr>(denominator) };
+                    match &mut self.run {
+                        Some(Run::Rationals(numerators, denominators)) => {
+                            numerators.push(numerator);
+                            denominators.push(denominator);
+                        }
+                        _ => self.run = Some(Run::Rationals(vec![numerator], vec![denominator])),
+                    }
+                }
+            }
+        }
+
+        fn flush(&mut self, rational_evals: &mut RationalEvals) {
+            match self.run.take() {
+                Some(Run::Zeros(len)) => rational_evals.set_zeros(self.offset, len),
+                Some(Run::Trivials(numerators)) => {
+                    rational_evals.set_trivials(self.offset, &numerators)
+                }
+                Some(Run::Rationals(numerators, denominators)) => {
+                    rational_evals.set_rationals(self.offset, &numerators, &denominators)
+                }
+                None => {}
+            }
+        }
+    }
+
     struct WitnessCollection<'a, F: Field> {
         k: u32,
         current_phase: sealed::Phase,
         advice: Vec<RationalEvals>,
+        pending_runs: Vec<PendingRun>,
         challenges: &'a HashMap<usize, F>,
         instances: &'a [&'a [F]],
         usable_rows: RangeTo<usize>,
         _marker: std::marker::PhantomData<F>,
     }
 
+    impl<'a, F: Field> WitnessCollection<'a, F> {
+        fn flush(&mut self) {
+            for (pending_run, rational_evals) in
+                self.pending_runs.iter_mut().zip(self.advice.iter_mut())
+            {
+                pending_run.flush(rational_evals);
+            }
+        }
+    }
+
     impl<'a, F: Field> Assignment<F> for WitnessCollection<'a, F> {
         fn enter_region<NR, N>(&mut self, _: N)
         where
@@ -171,18 +264,9 @@ pub fn create_proof<'params, W: Write, ConcreteCircuit: Circuit<Fr>>(
                 .ok_or(Error::BoundsFailure)?;
 
             let value = to().into_field().assign()?;
-            match &value {
-                Assigned::Zero => rational_evals.set_zero(row),
-                Assigned::Trivial(numerator) => {
-                    let numerator = unsafe { std::mem::transmute::<_, &Fr>(numerator) };
-                    rational_evals.set_trivial(row, numerator);
-                }
-                Assigned::Rational(numerator, denominator) => {
-                    let numerator = unsafe { std::mem::transmute::<_, &Fr>(numerator) };
-                    let denominator = unsafe { std::mem::transmute::<_, &Fr>(denominator) };
-                    rational_evals.set_rational(row, numerator, denominator)
-                }
-            }
+            // NOTE: Crossing the FFI per cell dominates the witness generation,
+            // so a run of consecutive rows is assigned at once.
+            self.pending_runs[column.index()].push(rational_evals, row, &value);
 
             Ok(())
         }
@@ -287,6 +371,9 @@ pub fn create_proof<'params, W: Write, ConcreteCircuit: Circuit<Fr>>(
                     k: prover.k(),
                     current_phase,
                     advice: vec![prover.empty_rational_evals(); num_advice_columns],
+                    pending_runs: (0..num_advice_columns)
+                        .map(|_| PendingRun::default())
+                        .collect(),
                     instances,
                     challenges: &challenges,
                     // The prover will not be allowed to assign values to advice
@@ -304,6 +391,7 @@ pub fn create_proof<'params, W: Write, ConcreteCircuit: Circuit<Fr>>(
                     config.clone(),
                     pk.constants(),
                 )?;
+                witness.flush();
 
                 #[cfg(feature = "phase-check")]
                 {